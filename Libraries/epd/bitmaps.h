@@ -7,6 +7,8 @@
  * All rights reserved. 
 */
 
+#include "GUI_Paint.h"
+
 const unsigned char gImage_icon_logo[2048] = { /* 0X81,0X01,0X80,0X00,0X80,0X00, */
 0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
 0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
@@ -890,3 +892,10 @@ const unsigned char gImage_next_event_logo[2368] = { /* 0X01,0X01,0X94,0X00,0X80
 0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,0XFF,
 };
 
+/* Lines of the logos are screen columns 128 pixels tall, as Image2Lcd
+   scanned them for the rotated canvas */
+const PAINT_BITMAP gBitmap_icon_logo = PAINT_BITMAP_COLUMNS(gImage_icon_logo, 128);
+const PAINT_BITMAP gBitmap_reserved_logo = PAINT_BITMAP_COLUMNS(gImage_reserved_logo, 128);
+const PAINT_BITMAP gBitmap_busy_logo = PAINT_BITMAP_COLUMNS(gImage_busy_logo, 128);
+const PAINT_BITMAP gBitmap_available_logo = PAINT_BITMAP_COLUMNS(gImage_available_logo, 128);
+const PAINT_BITMAP gBitmap_next_event_logo = PAINT_BITMAP_COLUMNS(gImage_next_event_logo, 128);
@@ -34,8 +34,12 @@
 #include "app_error.h"
 #include "nrf_lcd.h"
 #include "nrf_drv_spi.h"
+#include "app_timer.h"
+#include "nrf_soc.h"
 #include "epdif.h"
 #include "epd.h"
+#include "epd_refresh.h"
+#include "epd_power.h"
 #include "GUI_Paint.h"
 #include "fonts.h"
 #include "bitmaps.h"
@@ -51,6 +55,30 @@
 
 #define PRINT_ALARM_DATA_TIMEOUT 4 // Should be smaller than accelerometer timeout
 
+/* Requests are collected this long before the newest one is drawn */
+#ifndef EPD_SETTLE_WINDOW_MS
+#define EPD_SETTLE_WINDOW_MS 500
+#endif
+
+/* No request for this long is a quiet time, ghosting left by partial
+   refreshes is cleaned then. No wall clock here to find the store's
+   closing hours. */
+#ifndef EPD_QUIET_CLEAN_MS
+#define EPD_QUIET_CLEAN_MS (30UL * 60UL * 1000UL)
+#endif
+
+/******************************************************************************
+ * Private types
+ ******************************************************************************/
+typedef enum
+{
+  SCREEN_NONE,
+  SCREEN_RESERVED,
+  SCREEN_AVAILABLE,
+  SCREEN_NEXT_EVENT,
+  SCREEN_BUSY,
+} epd_screen_t;
+
 /******************************************************************************
  * Private function prototypes
  ******************************************************************************/
@@ -62,22 +90,35 @@
  * Private variables
  ******************************************************************************/
 static EPD epd;
-static unsigned char BW_Image[EPD_SCREEN_HEIGHT * EPD_WIDTH / 8]; /* Define Black canvas buffer */
-static unsigned char *R_Image;                                    /* Define Red canvas buffer */
-
-static const unsigned char table[250][40] = {"empty string", "Berkay Arslan", "Ata Korkusuz"};                                                          
-
-static bool is_print_data = false;
-
-/**
- *  @brief: turn on epaper
- */
-void paper_turn_on(void)
-{
-  // Turn on EPD MOSFET
-  nrf_gpio_cfg_output(EPD_EP_EN_PIN);
-  nrf_gpio_pin_write(EPD_EP_EN_PIN, 1); // 1 => ON, 0 => OFF
-}
+static unsigned char BW_Image[EPD_CANVAS ? EPD_SCREEN_HEIGHT * EPD_WIDTH_BYTES : 1]; /* Define Black canvas buffer */
+#if EPD_TRI_COLOR
+static unsigned char R_Image[EPD_RED_BUFFER_SIZE];                /* Define Red canvas buffer, red box only */
+static EPD_RedPlane red_plane;
+#endif
+
+APP_TIMER_DEF(m_settle_timer);
+APP_TIMER_DEF(m_quiet_timer);
+static bool settle_pending = false;
+static uint16_t dropped_requests;  /* Overwritten before they were drawn */
+
+/* Frame buffer holds a frame drawn but not sent yet, or one the running
+   refresh still reads */
+static bool frame_staged = false;
+static bool frame_in_use = false;
+static bool staged_same_layout;
+
+/* Screen drawn last, on the panel or on its way, and the one to show next */
+static epd_screen_t shown_screen = SCREEN_NONE;
+static epd_screen_t requested_screen = SCREEN_NONE;
+static unsigned char shown_text[DEVICE_NAME_MAX_LENGTH];
+static unsigned char requested_text[DEVICE_NAME_MAX_LENGTH];
+
+/* CRC16 of every canvas row and byte column of the frame last loaded to the
+   panel RAM, 612 bytes instead of a second frame buffer */
+static uint16_t row_hash[EPD_SCREEN_HEIGHT];
+static uint16_t column_hash[EPD_WIDTH_BYTES];
+
+static const EPD_Window full_window = {0, 0, EPD_WIDTH_BYTES * 8 - 1, EPD_SCREEN_HEIGHT - 1};
 
 int EPD_Init(EPD *epd)
 {
@@ -85,8 +126,12 @@ int EPD_Init(EPD *epd)
   epd->dc_pin = DC_PIN;
   epd->cs_pin = CS_PIN;
   epd->busy_pin = BUSY_PIN;
-  epd->width = EPD_WIDTH;
-  epd->height = EPD_HEIGHT;
+  epd->panel = &epd_panels[EPD_PANEL];
+  epd->width = epd->panel->width;
+  epd->height = epd->panel->height;
+  epd->ram_valid = false;
+  epd->red_loaded = false;
+  epd->waveform = EPD_WAVEFORM_FULL;
 
   /* this calls the peripheral hardware interface, see epdif */
   if (EpdInitCallback() != 0)
@@ -96,45 +141,13 @@ int EPD_Init(EPD *epd)
 
   /* EPD hardware init start */
   EPD_Reset(epd);
-  EPD_WaitUntilIdle(epd);
 
-  EPD_SendCommand(epd, 0x12);
-  EPD_WaitUntilIdle(epd);
-
-  EPD_SendCommand(epd, 0x01);
-  EPD_SendData(epd, (EPD_HEIGHT - 1) & 0xFF);
-  EPD_SendData(epd, ((EPD_HEIGHT - 1) >> 8) & 0xFF);
-  EPD_SendData(epd, 0x00);
-
-  EPD_SendCommand(epd, 0x11);
-  EPD_SendData(epd, 0x01);
-
-  EPD_SendCommand(epd, 0x44); //set Ram-X address start/end position
-  EPD_SendData(epd, 0x00);
-  EPD_SendData(epd, 0x0F); //0x0F-->(15+1)*8=128
-
-  EPD_SendCommand(epd, 0x45); //set Ram-Y address start/end position
-  EPD_SendData(epd, (EPD_HEIGHT - 1) & 0xFF);
-  EPD_SendData(epd, ((EPD_HEIGHT - 1) >> 8) & 0xFF);
-  EPD_SendData(epd, 0x00);
-  EPD_SendData(epd, 0x00);
-
-  EPD_SendCommand(epd, 0x3C); //BorderWavefrom
-  EPD_SendData(epd, 0x05);
-
-  EPD_SendCommand(epd, 0x18); //Read built-in temperature sensor
-  EPD_SendData(epd, 0x80);
+  if (EPD_SoftReset(epd) && !EPD_WaitUntilIdle(epd))
+  {
+    return -1;
+  }
 
-  EPD_SendCommand(epd, 0x21); //  Display update control
-  EPD_SendData(epd, 0x00);
-  EPD_SendData(epd, 0x80);
-
-  EPD_SendCommand(epd, 0x4E); // set RAM x address count to 0;
-  EPD_SendData(epd, 0x00);
-  EPD_SendCommand(epd, 0x4F); // set RAM y address count to 0X199;
-  EPD_SendData(epd, (EPD_HEIGHT - 1) & 0xFF);
-  EPD_SendData(epd, ((EPD_HEIGHT - 1) >> 8) & 0xFF);
-  EPD_WaitUntilIdle(epd);
+  EPD_Configure(epd);
 
   /* EPD hardware init end */
 
@@ -168,6 +181,15 @@ void EPD_DelayMs(EPD *epd, unsigned int delaytime)
   EpdDelayMsCallback(delaytime);
 }
 
+/**
+ *  @brief: wait until the last block sent is out of the interface,
+ *          before the caller reuses the memory it was sent from
+ */
+void EPD_Flush(EPD *epd)
+{
+  EpdSpiFlushCallback();
+}
+
 /**
  *  @brief: basic function for sending commands
  */
@@ -187,14 +209,88 @@ void EPD_SendData(EPD *epd, unsigned char data)
 }
 
 /**
- *  @brief: Wait until the busy_pin goes HIGH
+ *  @brief: send a whole block of data with a single DC switch,
+ *          the interface splits it into EasyDMA transfers
+ */
+void EPD_SendDataBuffer(EPD *epd, const unsigned char *data, unsigned int len)
+{
+  EPD_DigitalWrite(epd, epd->dc_pin, HIGH);
+  EpdSpiTransferCallback(data, len);
+}
+
+/**
+ *  @brief: send a command sequence, see EPD_SEQ_* in epdif.h. The records
+ *          between BUSY waits go out as one batch. Blocks on the waits,
+ *          the refresh engine sends the batches with EPD_SendSequenceBatch()
+ */
+void EPD_SendSequence(EPD *epd, const unsigned char *sequence)
+{
+  while ((sequence = EPD_SendSequenceBatch(epd, sequence)) != NULL)
+  {
+    if (!EPD_WaitUntilIdle(epd))
+    {
+      return;
+    }
+  }
+}
+
+/**
+ *  @brief: send the records of a sequence up to its next BUSY wait.
+ *          Returns where it goes on once the panel is idle, NULL at its end
+ */
+const unsigned char *EPD_SendSequenceBatch(EPD *epd, const unsigned char *sequence)
+{
+  return EpdSpiSequenceCallback(sequence);
+}
+
+/**
+ *  @brief: send len bytes of the same value, for margins and cleared planes
+ */
+void EPD_SendDataFill(EPD *epd, unsigned char value, unsigned int len)
+{
+  EPD_DigitalWrite(epd, epd->dc_pin, HIGH);
+  EpdSpiFillCallback(value, len);
+}
+
+/**
+ *  @brief: BUSY is high on SSD1680, low on UC8151 while the controller works
+ */
+bool EPD_IsBusy(EPD *epd)
+{
+  return (EPD_DigitalRead(epd, epd->busy_pin) == epd->panel->busy_level);
+}
+
+/**
+ *  @brief: Wait until the controller is idle.
+ *          Returns false if it is still busy after EPD_BUSY_TIMEOUT_DEFAULT_MS
+ */
+bool EPD_WaitUntilIdle(EPD *epd)
+{
+  uint32_t waited_ms = 0;
+
+  while (EPD_IsBusy(epd))
+  {
+    if (waited_ms++ >= EPD_BUSY_TIMEOUT_DEFAULT_MS)
+    {
+      return false;
+    }
+    EPD_DelayMs(epd, 1);
+  }
+  return true;
+}
+
+/**
+ *  @brief: send the SW reset of the controller, if it has one.
+ *          Returns true if BUSY tells when it is done.
  */
-void EPD_WaitUntilIdle(EPD *epd)
+bool EPD_SoftReset(EPD *epd)
 {
-  while (EPD_DigitalRead(epd, epd->busy_pin) == 1)
-  { //1: busy, 0: idle
-    //EPD_DelayMs(epd, 500);
+  if (epd->panel->cmd_sw_reset == 0)
+  {
+    return false;
   }
+  EPD_SendCommand(epd, epd->panel->cmd_sw_reset);
+  return true;
 }
 
 /**
@@ -205,9 +301,9 @@ void EPD_WaitUntilIdle(EPD *epd)
 void EPD_Reset(EPD *epd)
 {
   EPD_DigitalWrite(epd, epd->reset_pin, LOW); //module reset
-  EPD_DelayMs(epd, 200);
+  EPD_DelayMs(epd, EPD_RESET_PULSE_MS);
   EPD_DigitalWrite(epd, epd->reset_pin, HIGH);
-  EPD_DelayMs(epd, 200);
+  EPD_DelayMs(epd, EPD_RESET_RECOVERY_MS);
 }
 
 /**
@@ -215,116 +311,639 @@ void EPD_Reset(EPD *epd)
  */
 void EPD_SetLutBw(EPD *epd)
 {
-  unsigned int count;
   EPD_SendCommand(epd, 0x20); //g vcom
-  for (count = 0; count < 15; count++)
-  {
-    EPD_SendData(epd, lut_vcom0[count]);
-  }
+  EPD_SendDataBuffer(epd, lut_vcom0, 15);
   EPD_SendCommand(epd, 0x21); //g ww --
-  for (count = 0; count < 15; count++)
-  {
-    EPD_SendData(epd, lut_w[count]);
-  }
+  EPD_SendDataBuffer(epd, lut_w, 15);
   EPD_SendCommand(epd, 0x22); //g bw r
-  for (count = 0; count < 15; count++)
-  {
-    EPD_SendData(epd, lut_b[count]);
-  }
+  EPD_SendDataBuffer(epd, lut_b, 15);
   EPD_SendCommand(epd, 0x23); //g wb w
-  for (count = 0; count < 15; count++)
-  {
-    EPD_SendData(epd, lut_g1[count]);
-  }
+  EPD_SendDataBuffer(epd, lut_g1, 15);
   EPD_SendCommand(epd, 0x24); //g bb b
-  for (count = 0; count < 15; count++)
-  {
-    EPD_SendData(epd, lut_g2[count]);
-  }
+  EPD_SendDataBuffer(epd, lut_g2, 15);
 }
 
 void EPD_SetLutRed(EPD *epd)
 {
-  unsigned int count;
   EPD_SendCommand(epd, 0x25);
-  for (count = 0; count < 15; count++)
-  {
-    EPD_SendData(epd, lut_vcom1[count]);
-  }
+  EPD_SendDataBuffer(epd, lut_vcom1, 15);
   EPD_SendCommand(epd, 0x26);
-  for (count = 0; count < 15; count++)
+  EPD_SendDataBuffer(epd, lut_red0, 15);
+  EPD_SendCommand(epd, 0x27);
+  EPD_SendDataBuffer(epd, lut_red1, 15);
+}
+
+
+/**
+ *  @brief: blocking upload and refresh, see epd_refresh.c for the
+ *          non-blocking version
+ */
+void EPD_DisplayFrame(EPD *epd, const unsigned char *BW_Image, const EPD_RedPlane *red)
+{
+  EPD_LoadFrame(epd, BW_Image, red);
+  EPD_TurnOnDisplay(epd);
+  EPD_WaitUntilIdle(epd);
+}
+
+/**
+ *  @brief: UC8151 has no RAM window outside partial mode. The whole RAM
+ *          leaves partial mode, any other area enters it with that window,
+ *          which then also bounds the refresh. Arguments as EPD_SetRamArea().
+ */
+static void EPD_SetPartialWindow(EPD *epd, unsigned int x_start, unsigned int x_end,
+                                 unsigned int y_start, unsigned int y_end)
+{
+  /* Gates run down from the top, the SSD1680 RAM Y counter runs up */
+  unsigned int gate_start = EPD_HEIGHT - 1 - y_start;
+  unsigned int gate_end = EPD_HEIGHT - 1 - y_end;
+  static const uint8_t partial_out[] = {
+    PARTIAL_OUT, 0,
+    0x00, EPD_SEQ_END,
+  };
+
+  if (x_start == 0 && x_end == EPD_WIDTH_BYTES - 1 && gate_start == 0 && gate_end == EPD_HEIGHT - 1)
   {
-    EPD_SendData(epd, lut_red0[count]);
+    EPD_SendSequence(epd, partial_out);
+    return;
   }
-  EPD_SendCommand(epd, 0x27);
-  for (count = 0; count < 15; count++)
+
+  const uint8_t partial_window[] = {
+    PARTIAL_IN, 0,
+    PARTIAL_WINDOW, 9, ((x_start * 8) >> 8) & 0x01, (x_start * 8) & 0xFF,
+                       ((x_end * 8 + 7) >> 8) & 0x01, (x_end * 8 + 7) & 0xFF,
+                       (gate_start >> 8) & 0x01, gate_start & 0xFF,
+                       (gate_end >> 8) & 0x01, gate_end & 0xFF,
+                       0x01, // Gates scan inside the window only
+    0x00, EPD_SEQ_END,
+  };
+  EPD_SendSequence(epd, partial_window);
+}
+
+/**
+ *  @brief: set the RAM area written next and move the address counters
+ *          to its start. X is in bytes, Y in gates and counts down.
+ */
+static void EPD_SetRamArea(EPD *epd, unsigned int x_start, unsigned int x_end,
+                           unsigned int y_start, unsigned int y_end)
+{
+  if (epd->panel->controller == EPD_CONTROLLER_UC8151)
   {
-    EPD_SendData(epd, lut_red1[count]);
+    EPD_SetPartialWindow(epd, x_start, x_end, y_start, y_end);
+    return;
   }
+
+  const uint8_t ram_area[] = {
+    0x11, 1, EPD_DATA_ENTRY,                              //Data entry mode
+    0x44, 2, x_start, x_end,                              //set Ram-X address start/end position
+    0x45, 4, y_start & 0xFF, (y_start >> 8) & 0xFF,
+             y_end & 0xFF, (y_end >> 8) & 0xFF,           //set Ram-Y address start/end position
+    0x4E, 1, x_start,                                     //set RAM x address count
+    0x4F, 2, y_start & 0xFF, (y_start >> 8) & 0xFF,       //set RAM y address count
+    0x00, EPD_SEQ_END,
+  };
+  EPD_SendSequence(epd, ram_area);
 }
 
+/**
+ *  @brief: program the panel registers, needed after every reset since
+ *          a reset returns them to their defaults
+ */
+void EPD_Configure(EPD *epd)
+{
+  EPD_SendSequence(epd, epd->panel->init_sequence);
+  EPD_ConfigureEnd(epd);
+}
 
-void EPD_DisplayFrame(EPD *epd, const unsigned char *BW_Image, const unsigned char *R_Image)
+/**
+ *  @brief: rest of EPD_Configure(), once the init sequence of the panel
+ *          is sent and the panel is idle again
+ */
+void EPD_ConfigureEnd(EPD *epd)
 {
-  unsigned int Width, Height, i, j;
-  Width = (EPD_WIDTH % 8 == 0) ? (EPD_WIDTH / 8) : (EPD_WIDTH / 8 + 1);
-  Height = EPD_HEIGHT;
+#if EPD_RAM_PING_PONG
+  static const uint8_t ping_pong[] = {
+    0x37, 10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, //Display option: RAM ping-pong for mode 2
+    0x00, EPD_SEQ_END,
+  };
 
-  EPD_SendCommand(epd, 0x26);
-  for (j = 0; j < Height; j++)
+  EPD_SendSequence(epd, ping_pong);
+#endif
+
+  epd->waveform = EPD_WAVEFORM_FULL;
+
+  /* Data entry mode, RAM window and counters */
+  EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_HEIGHT - 1, 0);
+}
+
+/**
+ *  @brief: write the canvas to one RAM plane, margins are white
+ */
+static void EPD_LoadPlane(EPD *epd, unsigned char ram, const unsigned char *frame_buffer)
+{
+#if EPD_NATIVE_ORIENTATION
+  /* Columns would run through the margins, write them as areas of their own */
+  EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_HEIGHT - 1, EPD_RAM_Y(0) + 1);
+  EPD_SendCommand(epd, ram);
+  EPD_SendDataFill(epd, 0xFF, (EPD_WHITE_SPACE / 2) * EPD_WIDTH_BYTES);
+  EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_RAM_Y(EPD_SCREEN_HEIGHT), 0);
+  EPD_SendCommand(epd, ram);
+  EPD_SendDataFill(epd, 0xFF, (EPD_WHITE_SPACE - EPD_WHITE_SPACE / 2) * EPD_WIDTH_BYTES);
+  EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_RAM_Y(0), EPD_RAM_Y(EPD_SCREEN_HEIGHT - 1));
+  EPD_SendCommand(epd, ram);
+  EPD_SendDataBuffer(epd, frame_buffer, EPD_WIDTH_BYTES * EPD_SCREEN_HEIGHT);
+#else
+  EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_HEIGHT - 1, 0);
+  EPD_SendCommand(epd, ram);
+  EPD_SendDataFill(epd, 0xFF, (EPD_WHITE_SPACE / 2) * EPD_WIDTH_BYTES);
+  EPD_SendDataBuffer(epd, frame_buffer, EPD_WIDTH_BYTES * EPD_SCREEN_HEIGHT);
+  EPD_SendDataFill(epd, 0xFF, (EPD_WHITE_SPACE - EPD_WHITE_SPACE / 2) * EPD_WIDTH_BYTES);
+#endif
+}
+
+/**
+ *  @brief: CRC-16-CCITT step, same polynomial as the SDK crc16 library
+ */
+static uint16_t EPD_Crc16Step(uint16_t crc, unsigned char data)
+{
+  crc = (unsigned char)(crc >> 8) | (crc << 8);
+  crc ^= data;
+  crc ^= (unsigned char)(crc & 0xFF) >> 4;
+  crc ^= (crc << 8) << 4;
+  crc ^= ((crc & 0xFF) << 4) << 1;
+  return crc;
+}
+
+/**
+ *  @brief: hash the frame by rows and byte columns, store the hashes and
+ *          return the window covering the rows and columns that changed
+ *          since the previous call. Returns false if nothing changed.
+ *          Only area was loaded to the panel RAM: the hash of a row is
+ *          stored if area spans the whole row, else the row is marked
+ *          changed so the next diff loads it again, columns likewise.
+ *          Hashes outside area keep what the panel RAM holds.
+ */
+static bool EPD_UpdateShadow(const unsigned char *frame_buffer, const EPD_Window *area,
+                             EPD_Window *window)
+{
+  uint16_t column_crc[EPD_WIDTH_BYTES];
+  uint16_t crc;
+  unsigned int row, col;
+  unsigned int first_row = EPD_SCREEN_HEIGHT, last_row = 0;
+  unsigned int first_col = EPD_WIDTH_BYTES, last_col = 0;
+  bool full_rows = (area->x_start / 8 == 0 && area->x_end / 8 == EPD_WIDTH_BYTES - 1);
+  bool full_columns = (area->y_start == 0 && area->y_end == EPD_SCREEN_HEIGHT - 1);
+
+  for (col = 0; col < EPD_WIDTH_BYTES; col++)
+  {
+    column_crc[col] = 0xFFFF;
+  }
+
+  for (row = 0; row < EPD_SCREEN_HEIGHT; row++)
   {
-    for (i = 0; i < Width; i++)
+    crc = 0xFFFF;
+    for (col = 0; col < EPD_WIDTH_BYTES; col++)
     {
-      if(EPD_WHITE_SPACE)
-      {
-        EPD_SendData(epd,0x00);
-      }
-      else
+      crc = EPD_Crc16Step(crc, frame_buffer[EPD_FB_INDEX(col, row)]);
+      column_crc[col] = EPD_Crc16Step(column_crc[col], frame_buffer[EPD_FB_INDEX(col, row)]);
+    }
+    if (crc != row_hash[row])
+    {
+      if (row >= area->y_start && row <= area->y_end)
       {
-        EPD_SendData(epd, ~BW_Image[i + j * Width]);
+        row_hash[row] = full_rows ? crc : (uint16_t)~crc;
       }
+      first_row = (row < first_row) ? row : first_row;
+      last_row = row;
     }
   }
 
-  EPD_SendCommand(epd, 0x24);
-  for (j = 0; j < Height; j++)
+  for (col = 0; col < EPD_WIDTH_BYTES; col++)
   {
-    for (i = 0; i < Width; i++)
+    if (column_crc[col] != column_hash[col])
     {
-      if(EPD_WHITE_SPACE)
+      if (col >= area->x_start / 8 && col <= area->x_end / 8)
       {
-        if(j < EPD_WHITE_SPACE/2 || j > EPD_SCREEN_HEIGHT+EPD_WHITE_SPACE/2-1)
-        {
-          EPD_SendData(epd,0xff);
-        }
-        else
-        {
-          EPD_SendData(epd, BW_Image[i + (j-EPD_WHITE_SPACE/2) * Width]);
-        }
-      }
-      else
-      {
-        EPD_SendData(epd, BW_Image[i + j * Width]);
+        column_hash[col] = full_columns ? column_crc[col] : (uint16_t)~column_crc[col];
       }
+      first_col = (col < first_col) ? col : first_col;
+      last_col = col;
     }
   }
 
-  
-  EPD_SendCommand(epd, 0x22); //Display Update Control
-  EPD_SendData(epd, 0xF7);
-  EPD_SendCommand(epd, 0x20); //Activate Display Update Sequence
-  EPD_WaitUntilIdle(epd);
+  if (first_row > last_row)
+  {
+    return false;
+  }
+  if (first_col > last_col)
+  {
+    /* Column hashes collided, keep the full rows */
+    first_col = 0;
+    last_col = EPD_WIDTH_BYTES - 1;
+  }
+
+  window->x_start = first_col * 8;
+  window->x_end = last_col * 8 + 7;
+  window->y_start = first_row;
+  window->y_end = last_row;
+  return true;
+}
+
+#if !EPD_PARTIAL_REFRESH
+/**
+ *  @brief: write the red plane, 0x00 everywhere but the red box. The box
+ *          goes out as one block, the RAM window wraps its rows.
+ */
+static void EPD_LoadRedPlane(EPD *epd, const EPD_RedPlane *red)
+{
+  EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_HEIGHT - 1, 0);
+  EPD_SendCommand(epd, epd->panel->cmd_ram_old);
+  EPD_SendDataFill(epd, epd->panel->ram_old_blank, EPD_HEIGHT * EPD_WIDTH_BYTES);
+  epd->red_loaded = false;
+
+  if (red == NULL || red->image == NULL)
+  {
+    return;
+  }
+
+  EPD_SetRamArea(epd, red->window.x_start / 8, red->window.x_end / 8,
+                 EPD_RAM_Y(red->window.y_start), EPD_RAM_Y(red->window.y_end));
+  EPD_SendCommand(epd, epd->panel->cmd_ram_old);
+  EPD_SendDataBuffer(epd, red->image,
+                     (red->window.x_end / 8 - red->window.x_start / 8 + 1) *
+                     (red->window.y_end - red->window.y_start + 1));
+  epd->red_loaded = true;
+}
+#endif
+
+/**
+ *  @brief: write both planes to the panel RAM
+ */
+void EPD_LoadFrame(EPD *epd, const unsigned char *BW_Image, const EPD_RedPlane *red)
+{
+  EPD_Window window;
+
+  EPD_UpdateShadow(BW_Image, &full_window, &window);
+
+#if EPD_PARTIAL_REFRESH
+  /* Keep the frame on screen in 0x26 as the old image of the next partial refresh */
+  (void)red;
+  EPD_LoadPlane(epd, epd->panel->cmd_ram_old, BW_Image);
+#else
+  EPD_LoadRedPlane(epd, red);
+#endif
+
+  /* Black plane: white margins around the canvas, canvas in one block */
+  EPD_LoadPlane(epd, epd->panel->cmd_ram_new, BW_Image);
+
+  epd->ram_valid = true;
+}
+
+/**
+ *  @brief: write a window of the frame to the planes that hold it. A partial
+ *          load writes 0x24 only, the caller copies the window to 0x26 after
+ *          the update.
+ */
+static void EPD_LoadWindowPlanes(EPD *epd, const unsigned char *frame_buffer, bool partial,
+                                 const EPD_Window *window)
+{
+#if EPD_RAM_PING_PONG
+  /* The plane behind 0x24 alternates, it may hold an older frame outside the window */
+  (void)window;
+  if (!partial)
+  {
+    EPD_LoadPlane(epd, epd->panel->cmd_ram_old, frame_buffer);
+  }
+  EPD_LoadPlane(epd, epd->panel->cmd_ram_new, frame_buffer);
+#else
+#if EPD_PARTIAL_REFRESH
+  if (!partial)
+  {
+    EPD_LoadWindow(epd, epd->panel->cmd_ram_old, frame_buffer, window);
+  }
+#endif
+  EPD_LoadWindow(epd, epd->panel->cmd_ram_new, frame_buffer, window);
+#endif
+}
+
+/**
+ *  @brief: write only the window of the frame that changed since the last
+ *          frame loaded. Falls back to EPD_LoadFrame() if the panel RAM
+ *          does not hold that frame.
+ *          Returns false, without writing anything, if nothing changed.
+ */
+bool EPD_LoadFrameDiff(EPD *epd, const unsigned char *frame_buffer, bool partial,
+                       EPD_Window *window)
+{
+  if (!epd->ram_valid)
+  {
+    EPD_LoadFrame(epd, frame_buffer, NULL);
+    *window = full_window;
+    return true;
+  }
+
+  if (!EPD_UpdateShadow(frame_buffer, &full_window, window))
+  {
+    return false;
+  }
+
+  EPD_LoadWindowPlanes(epd, frame_buffer, partial, window);
+  return true;
+}
+
+/**
+ *  @brief: like EPD_LoadFrameDiff() for a window the caller knows to hold
+ *          every change. Only the shadow of the window is updated, a change
+ *          left outside it is still found by the next EPD_LoadFrameDiff().
+ *          Falls back to EPD_LoadFrame() if the panel RAM does not hold the
+ *          previous frame.
+ */
+void EPD_LoadFrameWindow(EPD *epd, const unsigned char *frame_buffer, bool partial,
+                         const EPD_Window *window)
+{
+  EPD_Window changed;
+
+  if (!epd->ram_valid)
+  {
+    EPD_LoadFrame(epd, frame_buffer, NULL);
+    return;
+  }
+
+  EPD_UpdateShadow(frame_buffer, window, &changed);
+  EPD_LoadWindowPlanes(epd, frame_buffer, partial, window);
+}
+
+/**
+ *  @brief: write a window of the canvas to one RAM plane (0x24 or 0x26)
+ */
+void EPD_LoadWindow(EPD *epd, unsigned char ram, const unsigned char *frame_buffer,
+                    const EPD_Window *window)
+{
+  unsigned int x_byte = window->x_start / 8;
+  unsigned int width = window->x_end / 8 - x_byte + 1;
+#if EPD_NATIVE_ORIENTATION
+  unsigned int rows, col;
+#else
+  unsigned int row;
+#endif
+
+  EPD_SetRamArea(epd, x_byte, x_byte + width - 1,
+                 EPD_RAM_Y(window->y_start), EPD_RAM_Y(window->y_end));
+
+  EPD_SendCommand(epd, ram);
+#if EPD_NATIVE_ORIENTATION
+  rows = window->y_end - window->y_start + 1;
+  if (rows == EPD_SCREEN_HEIGHT)
+  {
+    /* Full columns are contiguous in the canvas */
+    EPD_SendDataBuffer(epd, &frame_buffer[EPD_FB_INDEX(x_byte, 0)], width * rows);
+    return;
+  }
+
+  for (col = x_byte; col < x_byte + width; col++)
+  {
+    EPD_SendDataBuffer(epd, &frame_buffer[EPD_FB_INDEX(col, window->y_start)], rows);
+  }
+#else
+  if (width == EPD_WIDTH_BYTES)
+  {
+    /* Full rows are contiguous in the canvas */
+    EPD_SendDataBuffer(epd, &frame_buffer[window->y_start * EPD_WIDTH_BYTES],
+                       width * (window->y_end - window->y_start + 1));
+    return;
+  }
+
+  for (row = window->y_start; row <= window->y_end; row++)
+  {
+    EPD_SendDataBuffer(epd, &frame_buffer[x_byte + row * EPD_WIDTH_BYTES], width);
+  }
+#endif
+}
+
+/**
+ *  @brief: open the panel RAM for a streamed frame, see EPD_Stream. Without
+ *          a window the whole canvas is streamed. RAM outside the window
+ *          keeps the frame last loaded, or turns white if it was lost.
+ */
+void EPD_StreamBegin(EPD *epd, EPD_Stream *stream, const EPD_Window *window)
+{
+  if (window == NULL)
+  {
+    window = &full_window;
+  }
+
+#if EPD_TRI_COLOR
+  if (epd->red_loaded)
+  {
+    EPD_LoadRedPlane(epd, NULL);
+  }
+#endif
+  if (!epd->ram_valid)
+  {
+    EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_HEIGHT - 1, 0);
+    EPD_SendCommand(epd, epd->panel->cmd_ram_new);
+    EPD_SendDataFill(epd, 0xFF, EPD_HEIGHT * EPD_WIDTH_BYTES);
+  }
+
+  EPD_SetRamArea(epd, window->x_start / 8, window->x_end / 8,
+                 EPD_RAM_Y(window->y_start), EPD_RAM_Y(window->y_end));
+  EPD_SendCommand(epd, epd->panel->cmd_ram_new);
+
+  stream->remaining = (window->x_end / 8 - window->x_start / 8 + 1) *
+                      (window->y_end - window->y_start + 1);
+  stream->count = 0;
+  stream->repeat = false;
+
+  /* Frame buffer and shadow hashes no longer match the panel RAM */
+  epd->ram_valid = false;
+}
+
+/**
+ *  @brief: expand a chunk of the stream into the panel RAM. Literal bytes
+ *          are sent from the chunk itself, runs as fills, so the frame is
+ *          never held in RAM. Chunks may split packets anywhere. Returns
+ *          false if the chunk runs past the window.
+ */
+bool EPD_StreamWrite(EPD *epd, EPD_Stream *stream, const unsigned char *data, unsigned int len)
+{
+  unsigned int n;
+
+  while (len > 0)
+  {
+    if (stream->count == 0)
+    {
+      stream->count = (*data & 0x7F) + 1;
+      stream->repeat = (*data & 0x80) != 0;
+      data++;
+      len--;
+      continue;
+    }
+
+    n = stream->repeat ? stream->count : MIN(stream->count, len);
+    if (n > stream->remaining)
+    {
+      return false;
+    }
+
+    if (stream->repeat)
+    {
+      EPD_SendDataFill(epd, *data, n);
+      data++;
+      len--;
+    }
+    else
+    {
+      EPD_SendDataBuffer(epd, data, n);
+      data += n;
+      len -= n;
+    }
+    stream->count -= n;
+    stream->remaining -= n;
+  }
+
+  /* Wait for the last block, the chunk belongs to the caller */
+  EPD_Flush(epd);
+  return true;
+}
+
+/**
+ *  @brief: true if the stream filled the window exactly
+ */
+bool EPD_StreamEnd(EPD *epd, const EPD_Stream *stream)
+{
+  return (stream->remaining == 0 && stream->count == 0);
+}
+
+/**
+ *  @brief: pick the waveform profile for a full update
+ *  @param: temperature in degrees C
+ *  @param: layout_change, the whole screen changes rather than its content
+ */
+EPD_Waveform EPD_WaveformSelect(int temperature, bool layout_change)
+{
+  if (temperature < EPD_WAVEFORM_BALANCED_MIN_TEMP)
+  {
+    return EPD_WAVEFORM_FULL;
+  }
+  if (layout_change || temperature < EPD_WAVEFORM_FAST_MIN_TEMP)
+  {
+    return EPD_WAVEFORM_BALANCED;
+  }
+  return EPD_WAVEFORM_FAST;
+}
+
+/**
+ *  @brief: load the LUT of a short waveform, BUSY stays high until it is
+ *          loaded. The full waveform is loaded by the update itself.
+ */
+void EPD_LoadWaveform(EPD *epd, EPD_Waveform waveform)
+{
+  if (!(epd->panel->caps & EPD_CAP_FAST_LUT))
+  {
+    waveform = EPD_WAVEFORM_FULL;
+  }
+  epd->waveform = waveform;
+  if (waveform == EPD_WAVEFORM_FULL)
+  {
+    return;
+  }
+
+  const uint8_t load_waveform[] = {
+    0x1A, 2, (waveform == EPD_WAVEFORM_FAST) ? EPD_WAVEFORM_TEMP_FAST
+                                             : EPD_WAVEFORM_TEMP_BALANCED, 0x00, //Write to temperature register
+    0x22, 1, EPD_UPDATE_LOAD_LUT, //Display Update Control
+    0x20, 0,                      //Activate Display Update Sequence
+    0x00, EPD_SEQ_END,
+  };
+  EPD_SendSequence(epd, load_waveform);
+}
+
+/**
+ *  @brief: start the update sequence, BUSY stays high until it is done
+ */
+void EPD_TurnOnDisplay(EPD *epd)
+{
+  static const uint8_t update_full[] = {
+    0x22, 1, EPD_UPDATE_FULL, //Display Update Control
+    0x20, 0,                  //Activate Display Update Sequence
+    0x00, EPD_SEQ_END,
+  };
+  /* A loaded short waveform must not be replaced by the sensor's one */
+  static const uint8_t update_display[] = {
+    0x22, 1, EPD_UPDATE_DISPLAY,
+    0x20, 0,
+    0x00, EPD_SEQ_END,
+  };
+  static const uint8_t refresh_uc8151[] = {
+    PARTIAL_OUT, 0, // Refresh the whole panel, not the last window
+    DISPLAY_REFRESH, 0,
+    0x00, EPD_SEQ_END,
+  };
+
+  if (epd->panel->controller == EPD_CONTROLLER_UC8151)
+  {
+    EPD_SendSequence(epd, refresh_uc8151);
+  }
+  else
+  {
+    EPD_SendSequence(epd, (epd->waveform == EPD_WAVEFORM_FULL) ? update_full : update_display);
+  }
+}
+
+/**
+ *  @brief: start a mode 2 update, only pixels that differ between
+ *          0x24 (new) and 0x26 (old) are driven
+ */
+void EPD_TurnOnDisplayPartial(EPD *epd)
+{
+  static const uint8_t update_partial[] = {
+    0x22, 1, EPD_UPDATE_PARTIAL, //Display Update Control
+    0x20, 0,                     //Activate Display Update Sequence
+    0x00, EPD_SEQ_END,
+  };
+
+  EPD_SendSequence(epd, update_partial);
 }
 
 /* After this command is transmitted, the chip would enter the deep-sleep mode to save power. 
-   The deep sleep mode would return to standby by hardware reset. The only one parameter is a 
-   check code, the command would be executed if check code = 0xA5. 
+   The deep sleep mode would return to standby by hardware reset. The panel must be idle
+   when it is sent. SSD1680 takes it at once, UC8151 first waits on BUSY for the
+   power off, see EPD_SleepSequence().
+   Mode 1 keeps the RAM through sleep and reset, mode 2 loses it.
    You can use EPD_Reset() to awaken and EPD_Init() to initialize */
 void EPD_Sleep(EPD *epd)
 {
-  EPD_SendCommand(epd, 0x10); //Display Update Control
-  EPD_SendData(epd, 0x01);
-  nrf_delay_ms(100);
+  EPD_SendSequence(epd, EPD_SleepSequence(epd));
+  EPD_SleepEnd(epd);
+}
+
+/**
+ *  @brief: deep sleep sequence of the controller
+ */
+const unsigned char *EPD_SleepSequence(const EPD *epd)
+{
+  static const uint8_t sleep_ssd1680[] = {
+    0x10, 1, EPD_DEEP_SLEEP_MODE, //Deep Sleep Mode
+    0x00, EPD_SEQ_END,
+  };
+  static const uint8_t sleep_uc8151[] = {
+    VCOM_AND_DATA_INTERVAL_SETTING, 1, 0xF7, // Border floating
+    POWER_OFF, EPD_SEQ_WAIT | 0,
+    DEEP_SLEEP, 1, 0xA5,                     // Check code
+    0x00, EPD_SEQ_END,
+  };
+
+  return (epd->panel->controller == EPD_CONTROLLER_UC8151) ? sleep_uc8151 : sleep_ssd1680;
+}
+
+/**
+ *  @brief: panel state once the sleep sequence is sent
+ */
+void EPD_SleepEnd(EPD *epd)
+{
+  if (EPD_DEEP_SLEEP_MODE != 0x01 || !(epd->panel->caps & EPD_CAP_RAM_RETAIN))
+  {
+    epd->ram_valid = false;
+  }
 }
 
 const unsigned char lut_vcom0[] =
@@ -369,21 +988,21 @@ const unsigned char lut_red1[] =
 
 void EPD_WhiteScreen_ALL_Clean(EPD *epd)
 {
-  unsigned int i;
-  EPD_SendCommand(epd, 0x24); //write to Black RAM for black(0)/white (1)
-  for (i = 0; i < EPD_WIDTH * EPD_HEIGHT / 8; i++)
-  {
-    EPD_SendData(epd, 0xff);
-  }
-  EPD_SendCommand(epd, 0x26); //write to Red RAM for red(1)/white (0)
-  for (i = 0; i < EPD_WIDTH * EPD_HEIGHT / 8; i++)
-  {
-    EPD_SendData(epd, 0x00);
-  }
-  EPD_SendCommand(epd, 0x22); //Display Update Control
-  EPD_SendData(epd, 0xF7);
-  EPD_SendCommand(epd, 0x20); //Activate Display Update Sequence
+  EPD_SetRamArea(epd, 0, EPD_WIDTH_BYTES - 1, EPD_HEIGHT - 1, 0);
+  EPD_SendCommand(epd, epd->panel->cmd_ram_new); //write to Black RAM for black(0)/white (1)
+  EPD_SendDataFill(epd, 0xFF, EPD_HEIGHT * EPD_WIDTH_BYTES);
+  EPD_SendCommand(epd, epd->panel->cmd_ram_old); //write to Red RAM for red(1)/white (0)
+#if EPD_PARTIAL_REFRESH
+  EPD_SendDataFill(epd, 0xFF, EPD_HEIGHT * EPD_WIDTH_BYTES); // old image of the next partial refresh
+#else
+  EPD_SendDataFill(epd, epd->panel->ram_old_blank, EPD_HEIGHT * EPD_WIDTH_BYTES);
+#endif
+  epd->waveform = EPD_WAVEFORM_FULL;
+  EPD_TurnOnDisplay(epd);
   EPD_WaitUntilIdle(epd);
+
+  epd->ram_valid = false; /* RAM no longer matches the shadow hashes */
+  epd->red_loaded = false;
 }
 
 
@@ -391,48 +1010,128 @@ void EPD_WhiteScreen_ALL_Clean(EPD *epd)
  * Private function definitions
  ******************************************************************************/
 
-static void epd_print(void)
+static void epd_update(void);
+static const EPD_RedPlane *red_plane_get(void);
+
+static void epd_render(void);
+
+/**
+ *  @brief: frame is in the panel RAM, draw the next one while the panel
+ *          runs its waveform
+ */
+static void epd_frame_released(void)
 {
-    EPD_Reset(&epd);
-    EPD_DisplayFrame(&epd, BW_Image, R_Image); /* Display image */
-    EPD_Sleep(&epd);
+    frame_in_use = false;
+    epd_render();
 }
 
-void display_reserved(unsigned char * str_data)
+static void epd_print_done(void)
+{
+    EPD_SpiStats stats;
+
+    EpdSpiStatsGet(&stats);
+    NRF_LOG_INFO("EPD frame: %d SPI transactions, %d bytes", stats.transactions, stats.bytes);
+
+    if (epd_refresh_result_get() == NRF_ERROR_TIMEOUT)
+    {
+        /* Panel was power cycled, what it shows is unknown */
+        NRF_LOG_WARNING("EPD refresh timed out");
+        epd_refresh_stats_log();
+        shown_screen = SCREEN_NONE;
+    }
+
+    /* Send the screen drawn during the refresh, or pick up one requested then */
+    frame_in_use = false;
+    epd_update();
+
+    /* Clean partial refresh ghosting once no new screen came for a while */
+    APP_ERROR_CHECK(app_timer_stop(m_quiet_timer));
+    if (epd_refresh_ghosting_get())
+    {
+        APP_ERROR_CHECK(app_timer_start(m_quiet_timer, APP_TIMER_TICKS(EPD_QUIET_CLEAN_MS), NULL));
+    }
+}
+
+static void quiet_timeout_handler(void * p_context)
+{
+    UNUSED_PARAMETER(p_context);
+
+    /* A screen is on its way, its refresh restarts the timer */
+    if (requested_screen != SCREEN_NONE || frame_staged ||
+        epd_refresh_state_get() != EPD_REFRESH_IDLE)
+    {
+        return;
+    }
+
+    /* Frame buffer still holds the screen on the panel */
+    frame_in_use = true;
+    APP_ERROR_CHECK(epd_refresh_clean(BW_Image, red_plane_get(), epd_print_done));
+}
+
+/**
+ *  @brief: keep red drawn inside the box, in screen coordinates. Without a
+ *          red plane on the panel red is drawn black.
+ */
+static void select_red(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+#if EPD_TRI_COLOR
+  Paint_SelectRedImage(R_Image, sizeof(R_Image), Xstart, Ystart, Xend, Yend);
+#endif
+}
+
+/**
+ *  @brief: red plane of the frame drawn last, NULL if it has no red
+ */
+static const EPD_RedPlane *red_plane_get(void)
+{
+#if EPD_TRI_COLOR
+  if (Paint.ImageRed == NULL)
+  {
+    return NULL;
+  }
+
+  red_plane.image = Paint.ImageRed;
+  red_plane.window.x_start = Paint.RedXByte * 8;
+  red_plane.window.x_end = (Paint.RedXByte + Paint.RedWidthByte) * 8 - 1;
+  red_plane.window.y_start = Paint.RedY;
+  red_plane.window.y_end = Paint.RedY + Paint.RedHeight - 1;
+  return &red_plane;
+#else
+  return NULL;
+#endif
+}
+
+static void draw_reserved(const unsigned char * str_data)
 {
   Paint_Clear(WHITE);
 
-  Paint_DrawBitMap(gImage_reserved_logo, 128, 128, 0, 150);
+  Paint_DrawBitMap(&gBitmap_reserved_logo, 150, 0);
 
   Paint_DrawLine(10, 40, 140, 40, BLACK, LINE_STYLE_SOLID, DOT_PIXEL_2X2);
 
   Paint_DrawString_EN(10, 15, "RESERVED", &Font24, WHITE, BLACK);
 
-  Paint_DrawString_EN(10, 50, str_data, &Font20, WHITE, BLACK);
-
-  epd_print();
+  Paint_DrawString_EN(10, 50, (const char *)str_data, &Font20, WHITE, BLACK);
 }
 
-void display_available()
+static void draw_available(void)
 {
   Paint_Clear(WHITE);
   
-  Paint_DrawBitMap(gImage_available_logo, 128, 128, 0, 150);
+  Paint_DrawBitMap(&gBitmap_available_logo, 150, 0);
 
   Paint_DrawLine(10, 40, 160, 40, BLACK, LINE_STYLE_SOLID, DOT_PIXEL_2X2);
 
   Paint_DrawString_EN(10, 15, "AVAILABLE", &Font24, WHITE, BLACK);
 
   Paint_DrawString_EN(10, 50, "WAITING^CHECK-IN", &Font20, WHITE, BLACK);
-
-  epd_print();
 }
 
 //void display_next_event()
 //{
 //  Paint_Clear(WHITE);
   
-//  Paint_DrawBitMap(gImage_next_event_logo, 128, 128, 0, 120);
+//  Paint_DrawBitMap(&gBitmap_next_event_logo, 120, 0);
 
 //  Paint_DrawLine(0, 25, 130, 25, BLACK, LINE_STYLE_SOLID, DOT_PIXEL_2X2);
 
@@ -449,7 +1148,7 @@ void display_available()
 //{
 //  Paint_Clear(WHITE);
   
-//  Paint_DrawBitMap(gImage_busy_logo, 128, 128, 0, 120);
+//  Paint_DrawBitMap(&gBitmap_busy_logo, 120, 0);
 
 //  Paint_DrawLine(0, 35, 145, 35, BLACK, LINE_STYLE_SOLID, DOT_PIXEL_2X2);
 
@@ -460,48 +1159,249 @@ void display_available()
 //  epd_print();
 //}
 
-void display_next_event(unsigned char * str_data)
+static void draw_next_event(const unsigned char * str_data)
 {
   Paint_Clear(WHITE);
 
-  Paint_DrawBitMap(gImage_next_event_logo, 128, 128, 0, 140);
+  Paint_DrawBitMap(&gBitmap_next_event_logo, 140, 0);
 
   Paint_DrawLine(0, 27, 163, 27, BLACK, LINE_STYLE_SOLID, DOT_PIXEL_2X2);
 
   Paint_DrawString_EN(0, 5, "NEXT-EVENT", &Font24, WHITE, BLACK);
 
-  Paint_DrawString_EN(20, 45, str_data, &Font20, WHITE, BLACK);
-
-  epd_print();
+  Paint_DrawString_EN(20, 45, (const char *)str_data, &Font20, WHITE, BLACK);
 }
 
-void display_busy(unsigned char * str_data)
+static void draw_busy(const unsigned char * str_data)
 {
   Paint_Clear(WHITE);
 
-  Paint_DrawBitMap(gImage_busy_logo, 128, 128, 0, 140);
+  Paint_DrawBitMap(&gBitmap_busy_logo, 140, 0);
 
   Paint_DrawLine(0, 35, 148, 35, BLACK, LINE_STYLE_SOLID, DOT_PIXEL_2X2);
 
-  Paint_DrawString_EN(0, 10, "BUSY-TILL", &Font24, WHITE, BLACK);
+  select_red(0, 10, 152, 33);
+  Paint_DrawString_EN(0, 10, "BUSY-TILL", &Font24, WHITE, RED);
+
+  Paint_DrawString_EN(20, 40, (const char *)str_data, &Font24, WHITE, BLACK);
+}
+
+static void draw_screen(epd_screen_t screen, const unsigned char * str_data)
+{
+  Paint_SelectRedImage(NULL, 0, 0, 0, 0, 0);
+
+  switch (screen)
+  {
+    case SCREEN_RESERVED:
+      draw_reserved(str_data);
+      break;
+    case SCREEN_AVAILABLE:
+      draw_available();
+      break;
+    case SCREEN_NEXT_EVENT:
+      draw_next_event(str_data);
+      break;
+    case SCREEN_BUSY:
+      draw_busy(str_data);
+      break;
+    default:
+      break;
+  }
+}
 
-  Paint_DrawString_EN(20, 40, str_data, &Font24, WHITE, BLACK);
+/**
+ *  @brief: waveform for a full refresh. The die temperature stands in for
+ *          the panel's, the panel sensor cannot be read back without MISO.
+ */
+static EPD_Waveform epd_waveform_get(bool same_layout)
+{
+    int32_t temp;
 
-  epd_print();
+    if (red_plane_get() != NULL || sd_temp_get(&temp) != NRF_SUCCESS)
+    {
+        return EPD_WAVEFORM_FULL; /* No short waveform for red */
+    }
+
+    return EPD_WaveformSelect(temp / 4, !same_layout); /* 0.25 C steps */
+}
+
+/**
+ *  @brief: draw the requested screen into the frame buffer. Runs while the
+ *          panel refreshes too, once the running refresh released the
+ *          buffer, so the next frame is ready when the panel is.
+ */
+static void epd_render(void)
+{
+    /* Newer requests may still come in while the settle window is open */
+    if (requested_screen == SCREEN_NONE || settle_pending || frame_in_use || frame_staged)
+    {
+        return;
+    }
+
+    staged_same_layout = (requested_screen == shown_screen);
+    if (staged_same_layout && strcmp((const char *)requested_text, (const char *)shown_text) == 0)
+    {
+        requested_screen = SCREEN_NONE; /* Already on screen */
+        return;
+    }
+
+    draw_screen(requested_screen, requested_text);
+    shown_screen = requested_screen;
+    memcpy(shown_text, requested_text, sizeof(shown_text));
+    requested_screen = SCREEN_NONE;
+    frame_staged = true;
+}
+
+/**
+ *  @brief: send the frame drawn last to the panel. When only the text of
+ *          the screen on display changes, the changed window gets a
+ *          partial refresh instead of a full one.
+ */
+static void epd_send(void)
+{
+    ret_code_t err_code;
+
+    if (!frame_staged || epd_refresh_state_get() != EPD_REFRESH_IDLE)
+    {
+        return;
+    }
+
+    frame_staged = false;
+    frame_in_use = true;
+    EpdSpiStatsReset();
+    if (staged_same_layout)
+    {
+        err_code = epd_refresh_start_region(BW_Image, NULL, epd_print_done);
+        if (err_code != NRF_ERROR_NOT_SUPPORTED)
+        {
+            APP_ERROR_CHECK(err_code);
+            return;
+        }
+    }
+
+    epd_refresh_waveform_set(epd_waveform_get(staged_same_layout));
+    err_code = epd_refresh_start(BW_Image, red_plane_get(), epd_print_done); /* Display image */
+    APP_ERROR_CHECK(err_code);
+}
+
+static void epd_update(void)
+{
+    epd_render();
+    epd_send();
+}
+
+static void settle_timeout_handler(void * p_context)
+{
+  UNUSED_PARAMETER(p_context);
+
+  settle_pending = false;
+  if (dropped_requests > 0)
+  {
+    NRF_LOG_INFO("EPD: %d stale requests dropped", dropped_requests);
+    dropped_requests = 0;
+  }
+  epd_update();
+}
+
+/**
+ *  @brief: keep only the newest request. The first one opens the settle
+ *          window, the screen is drawn when it closes or, if the panel is
+ *          refreshing then, once the refresh released the frame buffer.
+ */
+static void epd_request(epd_screen_t screen, const unsigned char * str_data)
+{
+  if (!EPD_CANVAS)
+  {
+    return; /* No canvas to draw into, the panel shows streamed frames */
+  }
+
+  if (requested_screen != SCREEN_NONE)
+  {
+    dropped_requests++;
+  }
+
+  requested_screen = screen;
+  memset(requested_text, 0, sizeof(requested_text));
+  if (str_data != NULL)
+  {
+    strncpy((char *)requested_text, (const char *)str_data, sizeof(requested_text) - 1);
+  }
+
+  if (!settle_pending)
+  {
+    settle_pending = true;
+    APP_ERROR_CHECK(app_timer_start(m_settle_timer, APP_TIMER_TICKS(EPD_SETTLE_WINDOW_MS), NULL));
+  }
+}
+
+void display_reserved(unsigned char * str_data)
+{
+  epd_request(SCREEN_RESERVED, str_data);
+}
+
+void display_available()
+{
+  epd_request(SCREEN_AVAILABLE, NULL);
+}
+
+void display_next_event(unsigned char * str_data)
+{
+  epd_request(SCREEN_NEXT_EVENT, str_data);
+}
+
+void display_busy(unsigned char * str_data)
+{
+  epd_request(SCREEN_BUSY, str_data);
+}
+
+/**
+ *  @brief: show a frame streamed by the gateway, see EPD_Stream. Chunks go
+ *          to the panel as they are written, display_stream_write() can
+ *          take them straight from the BLE write event.
+ */
+ret_code_t display_stream_begin(const EPD_Window *p_window)
+{
+  ret_code_t err_code = epd_refresh_stream_begin(p_window, NULL);
+
+  if (err_code == NRF_SUCCESS)
+  {
+    shown_screen = SCREEN_NONE; /* Panel no longer shows the frame buffer */
+  }
+  return err_code;
+}
+
+ret_code_t display_stream_write(const uint8_t *p_data, uint16_t len)
+{
+  return epd_refresh_stream_write(p_data, len);
+}
+
+ret_code_t display_stream_end(void)
+{
+  EpdSpiStatsReset();
+  return epd_refresh_stream_end(epd_print_done);
 }
 
 void screen_init(void)
 {
-  paper_turn_on();
   LED_Init();
 
-  /* Init e-paper display */
-  EPD_GPIO_Init();
+  /* Init e-paper display, it is powered for updates only */
+  APP_ERROR_CHECK(epd_power_init());
+  epd_power_up();
   EPD_Init(&epd);
+  EPD_Sleep(&epd);
+  epd_power_down();
+  APP_ERROR_CHECK(epd_refresh_init(&epd));
+  epd_refresh_release_handler_set(epd_frame_released);
+  APP_ERROR_CHECK(app_timer_create(&m_settle_timer, APP_TIMER_MODE_SINGLE_SHOT, settle_timeout_handler));
+  APP_ERROR_CHECK(app_timer_create(&m_quiet_timer, APP_TIMER_MODE_SINGLE_SHOT, quiet_timeout_handler));
   
   Paint_NewImage(BW_Image, EPD_WIDTH, EPD_SCREEN_HEIGHT, 270, WHITE);      /* Set screen size and display orientation */
-  Paint_NewImage(R_Image, EPD_WIDTH, EPD_SCREEN_HEIGHT, 270, WHITE); /* Set screen size and display orientation */
+#if EPD_NATIVE_ORIENTATION
+  Paint_SetLayout(IMAGE_LAYOUT_COLUMNS); /* Controller does the rotation */
+#else
   Paint_SetMirroring(MIRROR_VERTICAL);
+#endif
   Paint_SelectImage(BW_Image); /* Set the virtual canvas data storage location */
 }
 
@@ -29,15 +29,99 @@
 
 #include "../font/fonts.h"
 #include <stdbool.h>
+#include "sdk_errors.h"
+#include "epd_panel.h"
 
-// Display resolution
+// Display resolution, from the panel picked by EPD_PANEL
 
-#define EPD_WIDTH 128
-#define EPD_HEIGHT 296
-#define EPD_SCREEN_HEIGHT 290
+#define EPD_WIDTH EPD_PANEL_WIDTH
+#define EPD_HEIGHT EPD_PANEL_HEIGHT
+#define EPD_SCREEN_HEIGHT (EPD_PANEL_HEIGHT - EPD_PANEL_MARGIN)
 
 #define EPD_WHITE_SPACE (EPD_HEIGHT - EPD_SCREEN_HEIGHT)
 
+#define EPD_WIDTH_BYTES ((EPD_WIDTH % 8 == 0) ? (EPD_WIDTH / 8) : (EPD_WIDTH / 8 + 1))
+
+// Panel has a red plane (black/white/red). The 0x26 RAM then holds the red
+// pixels and display mode 2 is not available.
+#define EPD_TRI_COLOR ((EPD_PANEL_CAPS & EPD_CAP_RED) != 0)
+
+// Panel has a display mode 2 (partial) waveform in OTP. The 0x26 RAM then
+// holds the frame on screen, which mode 2 uses as the old image.
+#define EPD_PARTIAL_REFRESH ((EPD_PANEL_CAPS & EPD_CAP_PARTIAL) != 0)
+
+// Screens are drawn on the tag into a canvas of the panel's size. The 4.2"
+// one would be 15 KB of the 17.7 KB of RAM the app has next to the S112,
+// that panel only shows frames streamed over BLE, see display_stream_begin().
+#define EPD_CANVAS (EPD_PANEL != EPD_PANEL_UC8151_420)
+
+// RAM ping-pong for display mode 2 (0x37). The controller then takes the
+// frame just shown as the old image of the next partial refresh by itself,
+// and the MCU no longer writes the window to 0x26 after each update. Which
+// plane is old and which is new alternates, so every upload is a whole
+// plane rather than the changed window.
+#define EPD_RAM_PING_PONG 0
+
+#if EPD_RAM_PING_PONG && !EPD_PARTIAL_REFRESH
+#error "EPD_RAM_PING_PONG needs a panel with display mode 2"
+#endif
+
+// Red content is kept for its bounding box only, not as a second frame
+#define EPD_RED_BUFFER_SIZE 640
+
+// Display update control 2 (0x22) sequences
+#define EPD_UPDATE_FULL     0xF7  // Load LUT and display with mode 1
+#define EPD_UPDATE_PARTIAL  0xFF  // Load LUT and display with mode 2
+#define EPD_UPDATE_LOAD_LUT 0x91  // Load the LUT picked by the temperature register
+#define EPD_UPDATE_DISPLAY  0xC7  // Display with mode 1 and the LUT loaded
+
+// Waveform profiles. The OTP holds one waveform per temperature range and
+// the ranges for hot panels are much shorter, so writing a high value to
+// the temperature register (0x1A) picks a short waveform. The values are
+// the ones used for SSD1680 2.9" panels, tune them for other OTPs.
+#define EPD_WAVEFORM_TEMP_BALANCED  0x50  // 80 C range
+#define EPD_WAVEFORM_TEMP_FAST      0x64  // 100 C range, about 1.5 s
+// Short waveforms leave ghosting on a cold panel, below these (degrees C)
+// the next longer profile is used
+#define EPD_WAVEFORM_FAST_MIN_TEMP      20
+#define EPD_WAVEFORM_BALANCED_MIN_TEMP  10
+
+// Hardware reset timing, the rest of the wake up is timed by BUSY
+#define EPD_RESET_PULSE_MS    10  // RES# low
+#define EPD_RESET_RECOVERY_MS 10  // RES# high before the first command
+
+// Longest BUSY wait before the panel is taken as stuck, until the refresh
+// engine has timings of its own
+#ifndef EPD_BUSY_TIMEOUT_DEFAULT_MS
+#define EPD_BUSY_TIMEOUT_DEFAULT_MS 30000
+#endif
+
+// Canvas bytes hold 8 pixels of a canvas column and run down the columns,
+// as the controller writes them with Y-first address increment (data entry
+// AM=1). The screen is then the canvas transposed, so Paint sets pixels in
+// screen coordinates with no rotation.
+#define EPD_NATIVE_ORIENTATION 0
+
+#if EPD_NATIVE_ORIENTATION && EPD_PANEL == EPD_PANEL_UC8151_420
+#error "EPD_NATIVE_ORIENTATION needs an SSD1680, UC8151 RAM is written by rows only"
+#endif
+
+#if EPD_NATIVE_ORIENTATION
+#define EPD_DATA_ENTRY 0x05  // Y decrement first, then X increment
+#define EPD_FB_INDEX(x_byte, row) ((x_byte) * EPD_SCREEN_HEIGHT + (row))
+#else
+#define EPD_DATA_ENTRY 0x01  // X increment first, then Y decrement
+#define EPD_FB_INDEX(x_byte, row) ((row) * EPD_WIDTH_BYTES + (x_byte))
+#endif
+
+// Deep sleep mode (0x10). Mode 1 (0x01) keeps the RAM, so the next update
+// can be a windowed upload and a partial refresh. Mode 2 (0x03) draws less
+// current but loses the RAM, every update is then a full one.
+#define EPD_DEEP_SLEEP_MODE 0x01
+
+// Panel RAM row (gate) of a canvas row, the RAM Y counter runs downwards
+#define EPD_RAM_Y(row) (EPD_HEIGHT - 1 - EPD_WHITE_SPACE / 2 - (row))
+
 #define ITEM_BITMAP_HEIGHT 96
 #define ITEM_BITMAP_WIDTH 96
 
@@ -71,6 +155,9 @@
 #define AUTO_MEASURE_VCOM 0x80
 #define VCOM_VALUE 0x81
 #define VCM_DC_SETTING_REGISTER 0x82
+#define PARTIAL_WINDOW 0x90
+#define PARTIAL_IN 0x91
+#define PARTIAL_OUT 0x92
 #define PROGRAM_MODE 0xA0
 #define ACTIVE_PROGRAM 0xA1
 #define READ_OTP_DATA 0xA2
@@ -84,31 +171,96 @@ extern const unsigned char lut_g2[];
 extern const unsigned char lut_red0[];
 extern const unsigned char lut_red1[];
 
+/* Window of the canvas memory, ends inclusive */
+typedef struct
+{
+  unsigned int x_start; // Pixel column, rounded down to a byte
+  unsigned int y_start; // Canvas row
+  unsigned int x_end;   // Pixel column, rounded up to a byte
+  unsigned int y_end;   // Canvas row
+} EPD_Window;
+
+typedef enum
+{
+  EPD_WAVEFORM_FULL,     // OTP waveform for the measured panel temperature
+  EPD_WAVEFORM_BALANCED, // Shorter, for screen changes in a warm store
+  EPD_WAVEFORM_FAST      // Shortest, for content changes in a warm store
+} EPD_Waveform;
+
+/* Red plane, only the bounding box of the red pixels is stored */
+typedef struct
+{
+  const unsigned char *image; // Rows of the box packed back to back, 1 = red
+  EPD_Window window;          // Box on the canvas, x on byte boundaries
+} EPD_RedPlane;
+
+/* Streamed frame, expanded straight into the panel RAM. The stream is the
+   window bytes in canvas order, packed as runs: a header byte 0x00-0x7F is
+   followed by that plus one literal bytes, a header 0x80-0xFF by one byte
+   repeated (header & 0x7F) + 1 times. */
+typedef struct
+{
+  unsigned int remaining; // Window bytes not written yet
+  uint8_t count;          // Bytes left in the run, 0 if a header is next
+  bool repeat;            // Run is a repeated byte
+} EPD_Stream;
+
 typedef struct EPD_t
 {
+  const EPD_Panel *panel;
   int reset_pin;
   int dc_pin;
   int cs_pin;
   int busy_pin;
   int width;
   int height;
+  bool ram_valid; // Panel RAM holds the last frame loaded, see EPD_LoadFrameDiff(),
+                  // cleared when it is lost: power up, mode 2 sleep, clear screen
+  bool red_loaded; // 0x26 RAM holds red pixels
+  EPD_Waveform waveform; // Loaded by EPD_LoadWaveform(), back to full after a reset
 } EPD;
 
 /* Hardware operating functions */
 void EPD_TurnOn(void);
 int EPD_Init(EPD *epd);
-void EPD_WaitUntilIdle(EPD *epd);
+bool EPD_WaitUntilIdle(EPD *epd);
+bool EPD_IsBusy(EPD *epd);
+bool EPD_SoftReset(EPD *epd);
 void EPD_DelayMs(EPD *epd, unsigned int delay_time);
 void EPD_Reset(EPD *epd);
+void EPD_Configure(EPD *epd);
+void EPD_ConfigureEnd(EPD *epd);
 void EPD_SetLutBw(EPD *epd);
 void EPD_SetLutRed(EPD *epd);
 void EPD_DisplayFrame(EPD *epd, const unsigned char *frame_buffer_black, 
-                      const unsigned char *frame_buffer_red);
+                      const EPD_RedPlane *red);
+void EPD_LoadFrame(EPD *epd, const unsigned char *frame_buffer_black,
+                   const EPD_RedPlane *red);
+void EPD_TurnOnDisplay(EPD *epd);
+EPD_Waveform EPD_WaveformSelect(int temperature, bool layout_change);
+void EPD_LoadWaveform(EPD *epd, EPD_Waveform waveform);
+void EPD_LoadWindow(EPD *epd, unsigned char ram, const unsigned char *frame_buffer,
+                    const EPD_Window *window);
+void EPD_TurnOnDisplayPartial(EPD *epd);
+void EPD_StreamBegin(EPD *epd, EPD_Stream *stream, const EPD_Window *window);
+bool EPD_StreamWrite(EPD *epd, EPD_Stream *stream, const unsigned char *data, unsigned int len);
+bool EPD_StreamEnd(EPD *epd, const EPD_Stream *stream);
+bool EPD_LoadFrameDiff(EPD *epd, const unsigned char *frame_buffer_black, bool partial,
+                       EPD_Window *window);
+void EPD_LoadFrameWindow(EPD *epd, const unsigned char *frame_buffer_black, bool partial,
+                         const EPD_Window *window);
 void EPD_Sleep(EPD *epd);
+const unsigned char *EPD_SleepSequence(const EPD *epd);
+void EPD_SleepEnd(EPD *epd);
 void EPD_DigitalWrite(EPD *epd, int pin, int value);
 int EPD_DigitalRead(EPD *epd, int pin);
 void EPD_SendCommand(EPD *epd, unsigned char command);
 void EPD_SendData(EPD *epd, unsigned char data);
+void EPD_SendDataBuffer(EPD *epd, const unsigned char *data, unsigned int len);
+void EPD_SendDataFill(EPD *epd, unsigned char value, unsigned int len);
+void EPD_SendSequence(EPD *epd, const unsigned char *sequence);
+const unsigned char *EPD_SendSequenceBatch(EPD *epd, const unsigned char *sequence);
+void EPD_Flush(EPD *epd);
 void EPD_WhiteScreen_ALL_Clean(EPD *epd);
 void screen_init(void);
 void all_leds_off(void);
@@ -117,6 +269,9 @@ void LED_Init(void);
 void LED_Run(void);
 void display_reserved(unsigned char * str_data);
 void display_available(void);
+ret_code_t display_stream_begin(const EPD_Window *p_window);
+ret_code_t display_stream_write(const uint8_t *p_data, uint16_t len);
+ret_code_t display_stream_end(void);
 #endif /* EPD1IN54B_H */
 
 /* END OF FILE */
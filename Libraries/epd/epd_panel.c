@@ -0,0 +1,109 @@
+/** @file epd_panel.c
+ *
+ * @brief Implements the registry of supported panels
+ *
+ * @par
+ * Init sequences hold what the reset leaves wrong for the panel. RAM window,
+ * data entry mode and the update itself are written by epd.c, which knows
+ * the controller from the descriptor.
+*/
+
+#include "epdif.h"
+#include "epd_panel.h"
+
+/* Bytes of a 16 bit register value */
+#define EPD_LOW_BYTE(value)   ((uint8_t)((value) & 0xFF))
+#define EPD_HIGH_BYTE(value)  ((uint8_t)(((value) >> 8) & 0xFF))
+
+/* SSD1680: driver output control (gates - 1), border, internal sensor, update control */
+static const uint8_t m_ssd1680_213_init[] = {
+  0x01, 3, EPD_LOW_BYTE(EPD_PANEL_SSD1680_213_HEIGHT - 1), EPD_HIGH_BYTE(EPD_PANEL_SSD1680_213_HEIGHT - 1), 0x00,
+  0x3C, 1, 0x05,
+  0x18, 1, 0x80,
+  0x21, 2, 0x00, 0x80,
+  0x00, EPD_SEQ_END,
+};
+
+/* Also the init of the 2.9" BWR panel, same gates */
+#if EPD_PANEL_SSD1680_290_BWR_HEIGHT != EPD_PANEL_SSD1680_290_HEIGHT
+#error "2.9in BWR panel needs its own init sequence"
+#endif
+static const uint8_t m_ssd1680_290_init[] = {
+  0x01, 3, EPD_LOW_BYTE(EPD_PANEL_SSD1680_290_HEIGHT - 1), EPD_HIGH_BYTE(EPD_PANEL_SSD1680_290_HEIGHT - 1), 0x00,
+  0x3C, 1, 0x05,
+  0x18, 1, 0x80,
+  0x21, 2, 0x00, 0x80,
+  0x00, EPD_SEQ_END,
+};
+
+/* UC8176: power setting, booster, power on, panel setting (KW mode, OTP LUT),
+   resolution, VCOM and data interval */
+static const uint8_t m_uc8151_420_init[] = {
+  0x01, 4, 0x03, 0x00, 0x2B, 0x2B,
+  0x06, 3, 0x17, 0x17, 0x17,
+  0x04, EPD_SEQ_WAIT | 0,
+  0x00, 1, 0x1F,
+  0x61, 4, EPD_HIGH_BYTE(EPD_PANEL_UC8151_420_WIDTH), EPD_LOW_BYTE(EPD_PANEL_UC8151_420_WIDTH),
+           EPD_HIGH_BYTE(EPD_PANEL_UC8151_420_HEIGHT), EPD_LOW_BYTE(EPD_PANEL_UC8151_420_HEIGHT),
+  0x50, 1, 0x97,
+  0x00, EPD_SEQ_END,
+};
+
+const EPD_Panel epd_panels[EPD_PANEL_COUNT] = {
+  [EPD_PANEL_SSD1680_213] = {
+    .name = "SSD1680 2.13in",
+    .controller = EPD_CONTROLLER_SSD1680,
+    .width = EPD_PANEL_SSD1680_213_WIDTH,
+    .height = EPD_PANEL_SSD1680_213_HEIGHT,
+    .margin = EPD_PANEL_SSD1680_213_MARGIN,
+    .caps = EPD_PANEL_SSD1680_213_CAPS,
+    .busy_level = HIGH,
+    .init_sequence = m_ssd1680_213_init,
+    .cmd_sw_reset = 0x12,
+    .cmd_ram_new = 0x24,
+    .cmd_ram_old = 0x26,
+    .ram_old_blank = 0x00,
+  },
+  [EPD_PANEL_SSD1680_290] = {
+    .name = "SSD1680 2.9in",
+    .controller = EPD_CONTROLLER_SSD1680,
+    .width = EPD_PANEL_SSD1680_290_WIDTH,
+    .height = EPD_PANEL_SSD1680_290_HEIGHT,
+    .margin = EPD_PANEL_SSD1680_290_MARGIN,
+    .caps = EPD_PANEL_SSD1680_290_CAPS,
+    .busy_level = HIGH,
+    .init_sequence = m_ssd1680_290_init,
+    .cmd_sw_reset = 0x12,
+    .cmd_ram_new = 0x24,
+    .cmd_ram_old = 0x26,
+    .ram_old_blank = 0x00,
+  },
+  [EPD_PANEL_SSD1680_290_BWR] = {
+    .name = "SSD1680 2.9in BWR",
+    .controller = EPD_CONTROLLER_SSD1680,
+    .width = EPD_PANEL_SSD1680_290_BWR_WIDTH,
+    .height = EPD_PANEL_SSD1680_290_BWR_HEIGHT,
+    .margin = EPD_PANEL_SSD1680_290_BWR_MARGIN,
+    .caps = EPD_PANEL_SSD1680_290_BWR_CAPS,
+    .busy_level = HIGH,
+    .init_sequence = m_ssd1680_290_init,
+    .cmd_sw_reset = 0x12,
+    .cmd_ram_new = 0x24,
+    .cmd_ram_old = 0x26,
+    .ram_old_blank = 0x00,
+  },
+  [EPD_PANEL_UC8151_420] = {
+    .name = "UC8176 4.2in",
+    .controller = EPD_CONTROLLER_UC8151,
+    .width = EPD_PANEL_UC8151_420_WIDTH,
+    .height = EPD_PANEL_UC8151_420_HEIGHT,
+    .margin = EPD_PANEL_UC8151_420_MARGIN,
+    .caps = EPD_PANEL_UC8151_420_CAPS,
+    .busy_level = LOW,
+    .init_sequence = m_uc8151_420_init,
+    .cmd_sw_reset = 0,
+    .cmd_ram_new = 0x13,
+    .cmd_ram_old = 0x10,
+    .ram_old_blank = 0xFF,
+  },
+};
@@ -0,0 +1,106 @@
+/** @file epd_panel.h
+ *
+ * @brief Header file of epd_panel.c, the registry of supported panels
+ *
+ * @par
+ * Every panel is described by an EPD_Panel: geometry, controller, init
+ * sequence, the commands that differ between controllers and what the
+ * panel can do. The panel the firmware is built for is picked with
+ * EPD_PANEL, its geometry and capabilities are also available as macros
+ * so buffers and code paths can be sized and compiled for it.
+*/
+
+#ifndef EPD_PANEL_H
+#define EPD_PANEL_H
+
+#include <stdint.h>
+
+// Panels in epd_panels[]
+#define EPD_PANEL_SSD1680_213      0  // 2.13" 122x250 black/white
+#define EPD_PANEL_SSD1680_290      1  // 2.9" 128x296 black/white, fitted on the ESL
+#define EPD_PANEL_SSD1680_290_BWR  2  // 2.9" 128x296 black/white/red
+#define EPD_PANEL_UC8151_420       3  // 4.2" 400x300 black/white, UC8176, streamed frames only
+#define EPD_PANEL_COUNT            4
+
+#ifndef EPD_PANEL
+#define EPD_PANEL EPD_PANEL_SSD1680_290
+#endif
+
+// Capabilities
+#define EPD_CAP_PARTIAL     0x01  // Display mode 2 waveform in OTP
+#define EPD_CAP_WINDOW      0x02  // RAM can be written through a window
+#define EPD_CAP_RED         0x04  // Second RAM plane is a red plane
+#define EPD_CAP_FAST_LUT    0x08  // Short waveforms through the temperature register
+#define EPD_CAP_RAM_RETAIN  0x10  // RAM survives deep sleep
+
+typedef enum
+{
+  EPD_CONTROLLER_SSD1680,  // Solomon SSD1680/SSD1675 family
+  EPD_CONTROLLER_UC8151    // UltraChip UC8151/UC8176 (IL0373/IL0398) family
+} EPD_Controller;
+
+typedef struct
+{
+  const char *name;
+  EPD_Controller controller;
+  uint16_t width;               // Sources, pixels
+  uint16_t height;              // Gates, rows
+  uint16_t margin;              // White rows around the canvas, half above and half below
+  uint8_t caps;                 // EPD_CAP_*
+  uint8_t busy_level;           // BUSY level while the controller is busy
+  const uint8_t *init_sequence; // Run after every reset, see EPD_SEQ_* in epdif.h
+  uint8_t cmd_sw_reset;         // 0 if the controller has none
+  uint8_t cmd_ram_new;          // Plane shown by a full update
+  uint8_t cmd_ram_old;          // Red plane, or old image of mode 2
+  uint8_t ram_old_blank;        // Value that leaves ram_old out of a full update
+} EPD_Panel;
+
+extern const EPD_Panel epd_panels[EPD_PANEL_COUNT];
+
+// Geometry and capabilities of every panel, epd_panels[] is built from these
+#define EPD_PANEL_SSD1680_213_WIDTH       122
+#define EPD_PANEL_SSD1680_213_HEIGHT      250
+#define EPD_PANEL_SSD1680_213_MARGIN      0
+#define EPD_PANEL_SSD1680_213_CAPS        (EPD_CAP_PARTIAL | EPD_CAP_WINDOW | EPD_CAP_FAST_LUT | EPD_CAP_RAM_RETAIN)
+
+#define EPD_PANEL_SSD1680_290_WIDTH       128
+#define EPD_PANEL_SSD1680_290_HEIGHT      296
+#define EPD_PANEL_SSD1680_290_MARGIN      6
+#define EPD_PANEL_SSD1680_290_CAPS        (EPD_CAP_PARTIAL | EPD_CAP_WINDOW | EPD_CAP_FAST_LUT | EPD_CAP_RAM_RETAIN)
+
+#define EPD_PANEL_SSD1680_290_BWR_WIDTH   128
+#define EPD_PANEL_SSD1680_290_BWR_HEIGHT  296
+#define EPD_PANEL_SSD1680_290_BWR_MARGIN  6
+#define EPD_PANEL_SSD1680_290_BWR_CAPS    (EPD_CAP_WINDOW | EPD_CAP_RED | EPD_CAP_RAM_RETAIN)
+
+#define EPD_PANEL_UC8151_420_WIDTH        400
+#define EPD_PANEL_UC8151_420_HEIGHT       300
+#define EPD_PANEL_UC8151_420_MARGIN       0
+#define EPD_PANEL_UC8151_420_CAPS         (EPD_CAP_WINDOW)
+
+// The panel built for
+#if EPD_PANEL == EPD_PANEL_SSD1680_213
+#define EPD_PANEL_WIDTH   EPD_PANEL_SSD1680_213_WIDTH
+#define EPD_PANEL_HEIGHT  EPD_PANEL_SSD1680_213_HEIGHT
+#define EPD_PANEL_MARGIN  EPD_PANEL_SSD1680_213_MARGIN
+#define EPD_PANEL_CAPS    EPD_PANEL_SSD1680_213_CAPS
+#elif EPD_PANEL == EPD_PANEL_SSD1680_290
+#define EPD_PANEL_WIDTH   EPD_PANEL_SSD1680_290_WIDTH
+#define EPD_PANEL_HEIGHT  EPD_PANEL_SSD1680_290_HEIGHT
+#define EPD_PANEL_MARGIN  EPD_PANEL_SSD1680_290_MARGIN
+#define EPD_PANEL_CAPS    EPD_PANEL_SSD1680_290_CAPS
+#elif EPD_PANEL == EPD_PANEL_SSD1680_290_BWR
+#define EPD_PANEL_WIDTH   EPD_PANEL_SSD1680_290_BWR_WIDTH
+#define EPD_PANEL_HEIGHT  EPD_PANEL_SSD1680_290_BWR_HEIGHT
+#define EPD_PANEL_MARGIN  EPD_PANEL_SSD1680_290_BWR_MARGIN
+#define EPD_PANEL_CAPS    EPD_PANEL_SSD1680_290_BWR_CAPS
+#elif EPD_PANEL == EPD_PANEL_UC8151_420
+#define EPD_PANEL_WIDTH   EPD_PANEL_UC8151_420_WIDTH
+#define EPD_PANEL_HEIGHT  EPD_PANEL_UC8151_420_HEIGHT
+#define EPD_PANEL_MARGIN  EPD_PANEL_UC8151_420_MARGIN
+#define EPD_PANEL_CAPS    EPD_PANEL_UC8151_420_CAPS
+#else
+#error "Unknown EPD_PANEL"
+#endif
+
+#endif /* EPD_PANEL_H */
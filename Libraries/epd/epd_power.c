@@ -0,0 +1,171 @@
+/** @file epd_power.c
+ *
+ * @brief Implements the EPD power domains
+ *
+ * @par
+*/
+
+#include "nrf_gpio.h"
+#include "nrf_log.h"
+#include "app_timer.h"
+#include "epdif.h"
+#include "epd_power.h"
+
+/* Panel current in deep sleep and while it is active, the ratio turns the
+   extra active time of a cold start into idle time at the break even */
+#ifndef EPD_POWER_SLEEP_UA
+#define EPD_POWER_SLEEP_UA        2
+#endif
+#ifndef EPD_POWER_ACTIVE_UA
+#define EPD_POWER_ACTIVE_UA       3000
+#endif
+/* Cold start penalty until both kinds of start were measured */
+#ifndef EPD_POWER_COLD_PENALTY_MS
+#define EPD_POWER_COLD_PENALTY_MS 2000
+#endif
+/* Idle times in a row past the break even before the rail is cut at once */
+#ifndef EPD_POWER_PREDICT_COUNT
+#define EPD_POWER_PREDICT_COUNT   3
+#endif
+
+APP_TIMER_DEF(m_off_timer);
+
+static epd_power_state_t m_state = EPD_POWER_OFF;
+static bool m_cold;             // Running update started with the rail off
+static uint32_t m_up_ticks;     // When it started
+static uint32_t m_cold_ms;      // Average active time of a cold update, 0 until measured
+static uint32_t m_warm_ms;      // Same from deep sleep
+static uint8_t m_long_idles;    // Idle times in a row that passed the break even
+static bool m_init_done;        // First power cycle is the panel init, not an update
+
+static void rail_off(void)
+{
+  // An unpowered panel must not be fed through its pins
+  nrf_gpio_cfg_default(EPD_DC_PIN);
+  nrf_gpio_cfg_default(EPD_RST_PIN);
+  nrf_gpio_cfg_default(EPD_SPI_CS_PIN);
+  nrf_gpio_cfg_default(EPD_SPI_SCK_PIN);
+  nrf_gpio_cfg_default(EPD_SPI_MOSI_PIN);
+  nrf_gpio_cfg_default(EPD_BUSY_PIN);
+  nrf_gpio_pin_write(EPD_EP_EN_PIN, 0); // 1 => ON, 0 => OFF
+
+  m_state = EPD_POWER_OFF;
+}
+
+/**@brief Function for averaging the active time of an update into its kind.
+ */
+static void active_time_add(uint32_t *p_average, uint32_t active_ms)
+{
+  if (*p_average == 0)
+  {
+    *p_average = active_ms;
+    return;
+  }
+  *p_average = *p_average - *p_average / 4 + active_ms / 4;
+}
+
+/**@brief Function for the idle time after which the rail is worth cutting.
+ */
+static uint32_t break_even_ms(void)
+{
+  uint32_t penalty_ms = EPD_POWER_COLD_PENALTY_MS;
+
+  if (m_cold_ms != 0 && m_warm_ms != 0)
+  {
+    penalty_ms = (m_cold_ms > m_warm_ms) ? (m_cold_ms - m_warm_ms) : 1;
+  }
+  return penalty_ms * (EPD_POWER_ACTIVE_UA / EPD_POWER_SLEEP_UA);
+}
+
+static void off_timeout_handler(void *p_context)
+{
+  UNUSED_PARAMETER(p_context);
+
+  if (m_long_idles < EPD_POWER_PREDICT_COUNT)
+  {
+    m_long_idles++;
+  }
+  if (m_state == EPD_POWER_SLEEP)
+  {
+    NRF_LOG_DEBUG("EPD: idle past break even, rail off");
+    rail_off();
+  }
+}
+
+ret_code_t epd_power_init(void)
+{
+  nrf_gpio_cfg_output(EPD_EP_EN_PIN);
+  rail_off();
+
+  return app_timer_create(&m_off_timer, APP_TIMER_MODE_SINGLE_SHOT, off_timeout_handler);
+}
+
+bool epd_power_up(void)
+{
+  if (m_state == EPD_POWER_ON)
+  {
+    return false;
+  }
+
+  // An update before the break even, the rail was worth keeping
+  APP_ERROR_CHECK(app_timer_stop(m_off_timer));
+  m_long_idles = 0;
+
+  m_cold = (m_state == EPD_POWER_OFF);
+  if (m_cold)
+  {
+    nrf_gpio_pin_write(EPD_EP_EN_PIN, 1);
+  }
+  EPD_GPIO_Init();
+  APP_ERROR_CHECK(epd_spi_init());
+
+  m_state = EPD_POWER_ON;
+  m_up_ticks = app_timer_cnt_get();
+  return m_cold;
+}
+
+void epd_power_down(void)
+{
+  uint32_t active_ms;
+
+  if (m_state != EPD_POWER_ON)
+  {
+    return;
+  }
+
+  epd_spi_uninit();
+  // Deselected, the controller is still powered
+  nrf_gpio_cfg_output(EPD_SPI_CS_PIN);
+  nrf_gpio_pin_write(EPD_SPI_CS_PIN, 1);
+  m_state = EPD_POWER_SLEEP;
+
+  active_ms = (uint64_t)app_timer_cnt_diff_compute(app_timer_cnt_get(), m_up_ticks) * 1000 *
+              (APP_TIMER_CONFIG_RTC_FREQUENCY + 1) / APP_TIMER_CLOCK_FREQ;
+  if (m_init_done)
+  {
+    active_time_add(m_cold ? &m_cold_ms : &m_warm_ms, active_ms);
+  }
+  m_init_done = true;
+
+  if (m_long_idles >= EPD_POWER_PREDICT_COUNT)
+  {
+    // Updates are rare, the timer only tells if they still are
+    rail_off();
+  }
+  APP_ERROR_CHECK(app_timer_start(m_off_timer, APP_TIMER_TICKS(break_even_ms()), NULL));
+}
+
+void epd_power_off(void)
+{
+  if (m_state == EPD_POWER_ON)
+  {
+    epd_spi_uninit();
+  }
+  APP_ERROR_CHECK(app_timer_stop(m_off_timer));
+  rail_off();
+}
+
+epd_power_state_t epd_power_state_get(void)
+{
+  return m_state;
+}
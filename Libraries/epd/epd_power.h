@@ -0,0 +1,55 @@
+/** @file epd_power.h
+ *
+ * @brief Header file of epd_power.c, the EPD power domains
+ *
+ * @par
+ * The panel rail (EP_EN MOSFET), the SPI peripheral and the panel pins are
+ * powered up for an update only. Between updates the SPI is released and
+ * the controller is in deep sleep. Once the tag stays idle past the break
+ * even time the rail is cut too: a cold start costs a longer wake up and,
+ * as the RAM is lost, a full refresh where a partial one would do. That
+ * cost is measured from the refreshes themselves.
+*/
+
+#ifndef EPD_POWER_H
+#define EPD_POWER_H
+
+#include <stdbool.h>
+#include "app_error.h"
+
+typedef enum
+{
+  EPD_POWER_OFF,    // Rail off, panel RAM lost
+  EPD_POWER_SLEEP,  // Rail on, controller in deep sleep, SPI released
+  EPD_POWER_ON,     // Rail and SPI on
+} epd_power_state_t;
+
+/**@brief Function for initializing the power domains, all off.
+ *
+ * @return NRF_SUCCESS, otherwise an error code from the timer.
+ */
+ret_code_t epd_power_init(void);
+
+/**@brief Function for powering the panel and the SPI up for an update.
+ *
+ * @details The rail needs the reset pulse that follows to settle.
+ *
+ * @return true if the rail was off, the panel RAM is blank then.
+ */
+bool epd_power_up(void);
+
+/**@brief Function for releasing the SPI once the controller is in deep sleep.
+ *
+ * @details The rail is cut at once if the last idle times all passed the
+ *          break even time, otherwise once this one does. The active time
+ *          of every update but the first, the panel init, is measured.
+ */
+void epd_power_down(void);
+
+/**@brief Function for cutting the rail at once, to restart a stuck controller.
+ */
+void epd_power_off(void);
+
+epd_power_state_t epd_power_state_get(void);
+
+#endif /* EPD_POWER_H */
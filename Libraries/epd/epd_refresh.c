@@ -0,0 +1,654 @@
+/** @file epd_refresh.c
+ *
+ * @brief Implements the non-blocking EPD refresh engine
+ *
+ * @par
+*/
+
+#include "nrf_gpio.h"
+#include "nrf_log.h"
+#include "nrf_drv_gpiote.h"
+#include "app_timer.h"
+#include "epdif.h"
+#include "epd.h"
+#include "epd_refresh.h"
+#include "epd_power.h"
+
+/* Ghosting budget, a full refresh is forced once partial refreshes used it up */
+#ifndef EPD_GHOST_MAX_PARTIALS
+#define EPD_GHOST_MAX_PARTIALS  20
+#endif
+#ifndef EPD_GHOST_MAX_AREA
+#define EPD_GHOST_MAX_AREA      (4UL * EPD_WIDTH * EPD_SCREEN_HEIGHT) // Pixels, summed over the windows
+#endif
+
+/* BUSY watchdog. A wait is given EPD_BUSY_TIMEOUT_HEADROOM times the longest
+   one seen in the phase for the profile, or EPD_BUSY_TIMEOUT_DEFAULT_MS until
+   there is one. The waveform of a full update stretches as the panel gets
+   colder than it was when the timings were taken, so its wait never gets less
+   than EPD_BUSY_TIMEOUT_FULL_MS. */
+#ifndef EPD_BUSY_TIMEOUT_HEADROOM
+#define EPD_BUSY_TIMEOUT_HEADROOM    4
+#endif
+#ifndef EPD_BUSY_TIMEOUT_MIN_MS
+#define EPD_BUSY_TIMEOUT_MIN_MS      1000
+#endif
+#ifndef EPD_BUSY_TIMEOUT_FULL_MS
+#define EPD_BUSY_TIMEOUT_FULL_MS     EPD_BUSY_TIMEOUT_DEFAULT_MS
+#endif
+
+/**@brief Steps of the wake up, the panel is in deep sleep between refreshes. */
+typedef enum
+{
+  EPD_WAKE_PULSE,     /**< RES# held low. */
+  EPD_WAKE_RECOVERY,  /**< RES# released, waiting before the first command. */
+  EPD_WAKE_SWRESET,   /**< SW reset sent, waiting for the controller to be idle. */
+  EPD_WAKE_CONFIGURE, /**< Init sequence of the panel, waiting on BUSY between its batches. */
+  EPD_WAKE_WAVEFORM   /**< Short waveform LUT loading. */
+} epd_wake_step_t;
+
+APP_TIMER_DEF(m_refresh_timer);
+
+static EPD *mp_epd;
+static epd_refresh_state_t m_state = EPD_REFRESH_IDLE;
+static epd_wake_step_t m_wake_step;
+static const unsigned char *mp_sequence; // Rest of the sequence after a BUSY wait
+static const unsigned char *mp_frame_black;
+static const EPD_RedPlane *mp_red;
+static epd_refresh_done_handler_t m_done_handler;
+static epd_refresh_done_handler_t m_release_handler;
+static epd_refresh_done_handler_t m_ready_handler;
+static bool m_stream;              // Frame comes through epd_refresh_stream_write()
+static EPD_Stream m_stream_state;
+static bool m_partial;
+static bool m_window_given;
+static EPD_Window m_window;
+static EPD_Waveform m_waveform = EPD_WAVEFORM_FULL;
+static bool m_clean;               // Full waveform refresh: clears ghosting, streamed frames
+static bool m_full_update;         // Running a mode 1 update
+static uint16_t m_ghost_partials;  // Partial refreshes since the last full one
+static uint32_t m_ghost_area;      // Pixels they drove
+static bool m_busy_waiting;        // Refresh timer is the BUSY watchdog
+static ret_code_t m_result = NRF_SUCCESS;
+static epd_refresh_phase_t m_phase;
+static uint32_t m_phase_ticks;     // Start of the running phase
+static uint16_t m_phase_ms[EPD_PHASE_COUNT];
+static uint8_t m_phases_done;      // Bit per phase timed in this refresh
+static epd_refresh_stats_t m_stats[EPD_PROFILE_COUNT];
+static uint8_t m_profile;
+
+static void refresh_advance(void);
+
+/**@brief Function for setting the profile the running refresh is timed under.
+ */
+static void profile_update(void)
+{
+  m_profile = m_partial ? EPD_PROFILE_PARTIAL : mp_epd->waveform;
+}
+
+/**@brief Function for recording the time of the running phase, the last one of a refresh.
+ */
+static void phase_end(void)
+{
+  uint32_t now = app_timer_cnt_get();
+  uint64_t ms = (uint64_t)app_timer_cnt_diff_compute(now, m_phase_ticks) * 1000 *
+                (APP_TIMER_CONFIG_RTC_FREQUENCY + 1) / APP_TIMER_CLOCK_FREQ;
+
+  m_phase_ms[m_phase] = (ms > UINT16_MAX) ? UINT16_MAX : (uint16_t)ms;
+  m_phases_done |= 1 << m_phase;
+  m_phase_ticks = now;
+}
+
+/**@brief Function for ending the running phase and starting the next one.
+ */
+static void phase_next(epd_refresh_phase_t next)
+{
+  phase_end();
+  m_phase = next;
+}
+
+/**@brief Function for adding the phases of a finished refresh to the statistics.
+ */
+static void stats_commit(void)
+{
+  epd_refresh_stats_t *p_stats = &m_stats[m_profile];
+  epd_refresh_phase_stats_t *p_phase;
+  uint8_t i;
+
+  for (i = 0; i < EPD_PHASE_COUNT; i++)
+  {
+    if (!(m_phases_done & (1 << i)))
+    {
+      continue;
+    }
+    p_phase = &p_stats->phase[i];
+    p_phase->avg_ms = (p_phase->count == 0) ? m_phase_ms[i]
+                      : (uint16_t)(p_phase->avg_ms - p_phase->avg_ms / 8 + m_phase_ms[i] / 8);
+    p_phase->max_ms = MAX(p_phase->max_ms, m_phase_ms[i]);
+    p_phase->count++;
+  }
+}
+
+static void timer_start(uint32_t delay_ms)
+{
+  APP_ERROR_CHECK(app_timer_start(m_refresh_timer, APP_TIMER_TICKS(delay_ms), NULL));
+}
+
+/**@brief Function for arming the BUSY line, refresh_advance() runs once it goes low.
+ *
+ * @details The refresh timer watches the wait, it is longer than the phase
+ *          ever took for this profile. BUSY is read again once the event is
+ *          enabled, an edge before that is lost. The caller may still be
+ *          working on the state, so an idle panel advances from the timer.
+ */
+static void busy_wait_start(void)
+{
+  const epd_refresh_phase_stats_t *p_phase = &m_stats[m_profile].phase[m_phase];
+  uint32_t timeout_ms = EPD_BUSY_TIMEOUT_DEFAULT_MS;
+
+  if (p_phase->count > 0)
+  {
+    timeout_ms = MAX((uint32_t)EPD_BUSY_TIMEOUT_HEADROOM * p_phase->max_ms, EPD_BUSY_TIMEOUT_MIN_MS);
+  }
+  if (m_phase == EPD_PHASE_REFRESH && m_full_update)
+  {
+    timeout_ms = MAX(timeout_ms, EPD_BUSY_TIMEOUT_FULL_MS);
+  }
+
+  m_busy_waiting = true;
+  timer_start(timeout_ms);
+  nrf_drv_gpiote_in_event_enable(EPD_BUSY_PIN, true);
+
+  if (!EPD_IsBusy(mp_epd))
+  {
+    nrf_drv_gpiote_in_event_disable(EPD_BUSY_PIN);
+    APP_ERROR_CHECK(app_timer_stop(m_refresh_timer));
+    m_busy_waiting = false;
+    APP_ERROR_CHECK(app_timer_start(m_refresh_timer, APP_TIMER_MIN_TIMEOUT_TICKS, NULL));
+  }
+}
+
+static void busy_evt_handler(nrf_drv_gpiote_pin_t pin, nrf_gpiote_polarity_t action)
+{
+  UNUSED_PARAMETER(pin);
+  UNUSED_PARAMETER(action);
+
+  if (!m_busy_waiting || EPD_IsBusy(mp_epd))
+  {
+    return;
+  }
+
+  nrf_drv_gpiote_in_event_disable(EPD_BUSY_PIN);
+  APP_ERROR_CHECK(app_timer_stop(m_refresh_timer));
+  m_busy_waiting = false;
+  refresh_advance();
+}
+
+/**@brief Function for giving up on a panel that keeps BUSY asserted.
+ *
+ * @details The rail is cut so the controller restarts from power on, the
+ *          done handler still runs and the result tells what happened.
+ */
+static void refresh_abort(void)
+{
+  nrf_drv_gpiote_in_event_disable(EPD_BUSY_PIN);
+  m_busy_waiting = false;
+
+  NRF_LOG_WARNING("EPD: BUSY stuck in phase %d, panel power cycled", m_phase);
+  m_stats[m_profile].phase[m_phase].timeouts++;
+
+  epd_power_off();
+  mp_epd->ram_valid = false;
+  mp_epd->red_loaded = false;
+  mp_epd->waveform = EPD_WAVEFORM_FULL;
+  m_stream = false;
+  m_result = NRF_ERROR_TIMEOUT;
+  m_state = EPD_REFRESH_IDLE;
+  if (m_done_handler != NULL)
+  {
+    m_done_handler();
+  }
+}
+
+static void refresh_timeout_handler(void *p_context)
+{
+  UNUSED_PARAMETER(p_context);
+
+  if (m_busy_waiting)
+  {
+    refresh_abort();
+    return;
+  }
+  refresh_advance();
+}
+
+/**@brief Function for moving the engine to its next state.
+ *
+ * @details Runs from the timer and GPIOTE handlers, which share one interrupt
+ *          priority with the SoftDevice event handlers, so it is never re-entered.
+ */
+static void refresh_advance(void)
+{
+  switch (m_state)
+  {
+    case EPD_REFRESH_RESET:
+      if (m_wake_step == EPD_WAKE_PULSE)
+      {
+        EPD_DigitalWrite(mp_epd, mp_epd->reset_pin, HIGH);
+        m_wake_step = EPD_WAKE_RECOVERY;
+        timer_start(EPD_RESET_RECOVERY_MS);
+        break;
+      }
+      if (m_wake_step == EPD_WAKE_RECOVERY)
+      {
+        m_wake_step = EPD_WAKE_SWRESET;
+        if (mp_epd->ram_valid)
+        {
+          // Short wake: the hardware reset already brought the registers
+          // to their defaults, and the RAM kept the frame through sleep
+          if (EPD_IsBusy(mp_epd))
+          {
+            busy_wait_start();
+            break;
+          }
+          refresh_advance();
+          break;
+        }
+        // BUSY tells when the reset is done, no fixed delay needed
+        if (EPD_SoftReset(mp_epd))
+        {
+          busy_wait_start();
+          break;
+        }
+        refresh_advance();
+        break;
+      }
+      if (m_wake_step == EPD_WAKE_SWRESET)
+      {
+        // The reset cleared the registers, program them before the upload
+        m_wake_step = EPD_WAKE_CONFIGURE;
+        mp_sequence = mp_epd->panel->init_sequence;
+      }
+      if (m_wake_step == EPD_WAKE_CONFIGURE)
+      {
+        // UC8151 powers on in the middle of its init sequence
+        mp_sequence = EPD_SendSequenceBatch(mp_epd, mp_sequence);
+        if (mp_sequence != NULL)
+        {
+          busy_wait_start();
+          break;
+        }
+        EPD_ConfigureEnd(mp_epd);
+        if (!m_partial && !m_clean && m_waveform != EPD_WAVEFORM_FULL &&
+            (mp_epd->panel->caps & EPD_CAP_FAST_LUT))
+        {
+          EPD_LoadWaveform(mp_epd, m_waveform);
+          m_wake_step = EPD_WAKE_WAVEFORM;
+          busy_wait_start();
+          break;
+        }
+      }
+      m_state = EPD_REFRESH_UPLOAD;
+      refresh_advance();
+      break;
+
+    case EPD_REFRESH_UPLOAD:
+      phase_next(EPD_PHASE_UPLOAD);
+      if (m_stream)
+      {
+        EPD_StreamBegin(mp_epd, &m_stream_state, m_window_given ? &m_window : NULL);
+        m_state = EPD_REFRESH_STREAM;
+        if (m_ready_handler != NULL)
+        {
+          m_ready_handler();
+        }
+        break;
+      }
+      if (!mp_epd->ram_valid)
+      {
+        // Panel RAM lost the frame, partial needs it as the base
+        m_partial = false;
+        m_window_given = false;
+      }
+      // Partial or not and the waveform are settled now
+      profile_update();
+      if (mp_red != NULL || mp_epd->red_loaded)
+      {
+        // Red box is loaded whole, and 0x26 is rewritten to drop the old one
+        EPD_LoadFrame(mp_epd, mp_frame_black, mp_red);
+      }
+      else if (m_window_given)
+      {
+        EPD_LoadFrameWindow(mp_epd, mp_frame_black, m_partial, &m_window);
+      }
+      else if (!EPD_LoadFrameDiff(mp_epd, mp_frame_black, m_partial, &m_window))
+      {
+        if (m_partial)
+        {
+          // Nothing changed, a partial refresh would not drive any pixel
+          m_state = EPD_REFRESH_UPDATE;
+          m_partial = false;
+          refresh_advance();
+          break;
+        }
+      }
+
+      if (m_partial)
+      {
+        EPD_TurnOnDisplayPartial(mp_epd);
+      }
+      else
+      {
+        EPD_TurnOnDisplay(mp_epd);
+      }
+      m_full_update = !m_partial;
+      m_state = EPD_REFRESH_UPDATE;
+      phase_next(EPD_PHASE_REFRESH);
+      busy_wait_start();
+      // The frame is in the panel RAM now, unless the window still has to
+      // go to 0x26 after the update
+      if (m_release_handler != NULL && !(m_partial && !EPD_RAM_PING_PONG))
+      {
+        m_release_handler();
+      }
+      break;
+
+    case EPD_REFRESH_UPDATE:
+      // The sleep phase takes the old image copy as well, see epd_refresh_phase_t
+      phase_next(EPD_PHASE_SLEEP);
+      if (m_partial)
+      {
+        // The new window is the old image of the next partial refresh,
+        // with RAM ping-pong the controller has already taken it as such
+        if (!EPD_RAM_PING_PONG)
+        {
+          EPD_LoadWindow(mp_epd, mp_epd->panel->cmd_ram_old, mp_frame_black, &m_window);
+        }
+        m_ghost_partials++;
+        m_ghost_area += (uint32_t)(m_window.x_end - m_window.x_start + 1) *
+                        (m_window.y_end - m_window.y_start + 1);
+      }
+      if (m_full_update)
+      {
+        // Mode 1 drives every pixel, ghosting is gone
+        m_ghost_partials = 0;
+        m_ghost_area = 0;
+      }
+      mp_sequence = EPD_SleepSequence(mp_epd);
+      m_state = EPD_REFRESH_SLEEP;
+      refresh_advance();
+      break;
+
+    case EPD_REFRESH_SLEEP:
+      // UC8151 powers off before it takes the deep sleep command
+      mp_sequence = EPD_SendSequenceBatch(mp_epd, mp_sequence);
+      if (mp_sequence != NULL)
+      {
+        busy_wait_start();
+        break;
+      }
+      EPD_SleepEnd(mp_epd);
+      // Deep sleep is entered, the panel can be woken right away
+      epd_power_down();
+      phase_end();
+      stats_commit();
+      m_state = EPD_REFRESH_IDLE;
+      if (m_done_handler != NULL)
+      {
+        m_done_handler();
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+ret_code_t epd_refresh_init(EPD *p_epd)
+{
+  ret_code_t err_code;
+  nrf_drv_gpiote_in_config_t busy_config = GPIOTE_CONFIG_IN_SENSE_TOGGLE(false);
+
+  mp_epd = p_epd;
+  m_state = EPD_REFRESH_IDLE;
+
+  err_code = app_timer_create(&m_refresh_timer, APP_TIMER_MODE_SINGLE_SHOT, refresh_timeout_handler);
+  if (err_code != NRF_SUCCESS)
+  {
+    return err_code;
+  }
+
+  if (!nrf_drv_gpiote_is_init())
+  {
+    err_code = nrf_drv_gpiote_init();
+    if (err_code != NRF_SUCCESS)
+    {
+      return err_code;
+    }
+  }
+
+  // Low power PORT event, the panel only toggles BUSY a few times per refresh
+  busy_config.pull = NRF_GPIO_PIN_PULLUP;
+  return nrf_drv_gpiote_in_init(EPD_BUSY_PIN, &busy_config, busy_evt_handler);
+}
+
+static void refresh_start(const unsigned char *frame_buffer_black,
+                          const EPD_RedPlane *p_red,
+                          epd_refresh_done_handler_t done_handler)
+{
+  mp_frame_black = frame_buffer_black;
+  mp_red = p_red;
+  m_done_handler = done_handler;
+  m_full_update = false;
+  m_stream = false;
+  m_result = NRF_SUCCESS;
+  m_phase = EPD_PHASE_RESET;
+  m_phase_ticks = app_timer_cnt_get();
+  m_phases_done = 0;
+  // Waveform the wake up is expected to load, settled in the upload
+  m_profile = m_partial ? EPD_PROFILE_PARTIAL
+            : (m_clean || !(mp_epd->panel->caps & EPD_CAP_FAST_LUT)) ? EPD_WAVEFORM_FULL
+            : m_waveform;
+
+  if (epd_power_up())
+  {
+    // Rail was off, the panel RAM came up blank
+    mp_epd->ram_valid = false;
+    mp_epd->red_loaded = false;
+  }
+
+  m_state = EPD_REFRESH_RESET;
+  m_wake_step = EPD_WAKE_PULSE;
+  EPD_DigitalWrite(mp_epd, mp_epd->reset_pin, LOW); // module reset
+  timer_start(EPD_RESET_PULSE_MS);
+}
+
+ret_code_t epd_refresh_start(const unsigned char *frame_buffer_black,
+                             const EPD_RedPlane *p_red,
+                             epd_refresh_done_handler_t done_handler)
+{
+  if (m_state != EPD_REFRESH_IDLE)
+  {
+    return NRF_ERROR_BUSY;
+  }
+
+  m_partial = false;
+  m_window_given = false;
+  m_clean = false;
+  refresh_start(frame_buffer_black, p_red, done_handler);
+
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_start_region(const unsigned char *frame_buffer_black,
+                                    const EPD_Window *p_window,
+                                    epd_refresh_done_handler_t done_handler)
+{
+  if (!EPD_PARTIAL_REFRESH)
+  {
+    return NRF_ERROR_NOT_SUPPORTED;
+  }
+  if (m_state != EPD_REFRESH_IDLE)
+  {
+    return NRF_ERROR_BUSY;
+  }
+
+  m_partial = true;
+  m_window_given = (p_window != NULL);
+  if (m_window_given)
+  {
+    m_window = *p_window;
+  }
+  m_clean = false;
+  if (m_ghost_partials >= EPD_GHOST_MAX_PARTIALS || m_ghost_area >= EPD_GHOST_MAX_AREA)
+  {
+    // Ghosting budget used up, this one gets a full refresh
+    NRF_LOG_INFO("EPD: ghosting budget used, full refresh");
+    m_partial = false;
+    m_window_given = false;
+    m_clean = true;
+  }
+  refresh_start(frame_buffer_black, NULL, done_handler);
+
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_clean(const unsigned char *frame_buffer_black,
+                             const EPD_RedPlane *p_red,
+                             epd_refresh_done_handler_t done_handler)
+{
+  if (m_state != EPD_REFRESH_IDLE)
+  {
+    return NRF_ERROR_BUSY;
+  }
+
+  m_partial = false;
+  m_window_given = false;
+  m_clean = true;
+  refresh_start(frame_buffer_black, p_red, done_handler);
+
+  return NRF_SUCCESS;
+}
+
+void epd_refresh_release_handler_set(epd_refresh_done_handler_t release_handler)
+{
+  m_release_handler = release_handler;
+}
+
+ret_code_t epd_refresh_stream_begin(const EPD_Window *p_window,
+                                    epd_refresh_done_handler_t ready_handler)
+{
+  if (m_state != EPD_REFRESH_IDLE)
+  {
+    return NRF_ERROR_BUSY;
+  }
+  // The window comes from the gateway
+  if (p_window != NULL &&
+      (p_window->x_start > p_window->x_end || p_window->x_end >= EPD_WIDTH_BYTES * 8 ||
+       p_window->y_start > p_window->y_end || p_window->y_end >= EPD_SCREEN_HEIGHT))
+  {
+    return NRF_ERROR_INVALID_PARAM;
+  }
+
+  m_partial = false;
+  m_window_given = (p_window != NULL);
+  if (m_window_given)
+  {
+    m_window = *p_window;
+  }
+  // A streamed frame can be any image, it gets the full waveform
+  m_clean = true;
+  refresh_start(NULL, NULL, NULL);
+  m_stream = true;
+  m_ready_handler = ready_handler;
+
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_stream_write(const uint8_t *p_data, uint16_t len)
+{
+  if (m_state != EPD_REFRESH_STREAM)
+  {
+    return NRF_ERROR_INVALID_STATE;
+  }
+
+  if (!EPD_StreamWrite(mp_epd, &m_stream_state, p_data, len))
+  {
+    return NRF_ERROR_INVALID_DATA;
+  }
+
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_stream_end(epd_refresh_done_handler_t done_handler)
+{
+  if (m_state != EPD_REFRESH_STREAM)
+  {
+    return NRF_ERROR_INVALID_STATE;
+  }
+
+  m_stream = false;
+  m_done_handler = done_handler;
+  if (!EPD_StreamEnd(mp_epd, &m_stream_state))
+  {
+    // Part of the window is missing, leave the screen as it is
+    phase_next(EPD_PHASE_SLEEP);
+    mp_sequence = EPD_SleepSequence(mp_epd);
+    m_state = EPD_REFRESH_SLEEP;
+    refresh_advance();
+    return NRF_ERROR_INVALID_LENGTH;
+  }
+
+  m_full_update = true;
+  EPD_TurnOnDisplay(mp_epd);
+  m_state = EPD_REFRESH_UPDATE;
+  phase_next(EPD_PHASE_REFRESH);
+  busy_wait_start();
+
+  return NRF_SUCCESS;
+}
+
+bool epd_refresh_ghosting_get(void)
+{
+  return (m_ghost_partials > 0);
+}
+
+void epd_refresh_waveform_set(EPD_Waveform waveform)
+{
+  m_waveform = waveform;
+}
+
+epd_refresh_state_t epd_refresh_state_get(void)
+{
+  return m_state;
+}
+
+ret_code_t epd_refresh_result_get(void)
+{
+  return m_result;
+}
+
+const epd_refresh_stats_t *epd_refresh_stats_get(uint8_t profile)
+{
+  return &m_stats[(profile < EPD_PROFILE_COUNT) ? profile : EPD_WAVEFORM_FULL];
+}
+
+void epd_refresh_stats_log(void)
+{
+  uint8_t profile, i;
+  const epd_refresh_phase_stats_t *p_phase;
+
+  for (profile = 0; profile < EPD_PROFILE_COUNT; profile++)
+  {
+    for (i = 0; i < EPD_PHASE_COUNT; i++)
+    {
+      p_phase = &m_stats[profile].phase[i];
+      if (p_phase->count == 0)
+      {
+        continue;
+      }
+      NRF_LOG_INFO("EPD profile %d phase %d: %d runs, avg %d ms, max %d ms, %d timeouts",
+                   profile, i, p_phase->count, p_phase->avg_ms, p_phase->max_ms, p_phase->timeouts);
+    }
+  }
+}
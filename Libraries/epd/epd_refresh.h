@@ -0,0 +1,206 @@
+/** @file epd_refresh.h
+ *
+ * @brief Header file of epd_refresh.c, the non-blocking EPD refresh engine
+ *
+ * @par
+ * A refresh runs as reset -> upload -> refresh -> sleep. Waiting on the
+ * reset timing is done with an app_timer and waiting on the panel with a
+ * GPIOTE event on the BUSY line, so the CPU can sleep in between.
+ * 
+*/
+
+#ifndef EPD_REFRESH_H
+#define EPD_REFRESH_H
+
+#include <stdbool.h>
+#include "app_error.h"
+#include "epd.h"
+
+typedef enum
+{
+  EPD_REFRESH_IDLE,     // Panel asleep, engine ready for a new frame
+  EPD_REFRESH_RESET,    // Waking the panel up
+  EPD_REFRESH_UPLOAD,   // Writing the frame to the panel RAM
+  EPD_REFRESH_STREAM,   // Panel awake, taking a streamed frame
+  EPD_REFRESH_UPDATE,   // Panel is running its update waveform
+  EPD_REFRESH_SLEEP,    // Putting the panel into deep sleep
+} epd_refresh_state_t;
+
+/* Phases a refresh is timed in */
+typedef enum
+{
+  EPD_PHASE_RESET,    // Wake up: reset, SW reset, short waveform load
+  EPD_PHASE_UPLOAD,   // Frame to the panel RAM
+  EPD_PHASE_REFRESH,  // Update waveform, until BUSY drops
+  EPD_PHASE_SLEEP,    // Old image copy of a partial refresh and deep sleep
+  EPD_PHASE_COUNT
+} epd_refresh_phase_t;
+
+/* Statistics are kept per waveform, partial refreshes have their own */
+#define EPD_PROFILE_PARTIAL  (EPD_WAVEFORM_FAST + 1)
+#define EPD_PROFILE_COUNT    (EPD_PROFILE_PARTIAL + 1)
+
+typedef struct
+{
+  uint32_t count;     // Times the phase ran
+  uint16_t timeouts;  // Times BUSY got stuck in it
+  uint16_t avg_ms;    // Rolling average
+  uint16_t max_ms;
+} epd_refresh_phase_stats_t;
+
+typedef struct
+{
+  epd_refresh_phase_stats_t phase[EPD_PHASE_COUNT];
+} epd_refresh_stats_t;
+
+typedef void (*epd_refresh_done_handler_t)(void);
+
+/**@brief Function for initializing the refresh engine.
+ *
+ * @param[in] p_epd  Initialized EPD instance the engine drives.
+ *
+ * @return NRF_SUCCESS, otherwise an error code from the timer or GPIOTE driver.
+ */
+ret_code_t epd_refresh_init(EPD *p_epd);
+
+/**@brief Function for starting a refresh with the given frame.
+ *
+ * @details Only the window that changed since the previous frame is uploaded
+ *          when the panel RAM still holds that frame and neither it nor the
+ *          new one has red pixels. The frame buffers must not be redrawn
+ *          before the release or the done handler runs.
+ *
+ * @param[in] frame_buffer_black  Black plane.
+ * @param[in] p_red               Red plane, NULL if there is no red.
+ * @param[in] done_handler        Called once the panel is back asleep, may be NULL.
+ *
+ * @return NRF_SUCCESS, or NRF_ERROR_BUSY if a refresh is already running.
+ */
+ret_code_t epd_refresh_start(const unsigned char *frame_buffer_black,
+                             const EPD_RedPlane *p_red,
+                             epd_refresh_done_handler_t done_handler);
+
+/**@brief Function for starting a partial (display mode 2) refresh of a window.
+ *
+ * @details Only the window is uploaded. If the panel RAM does not hold the
+ *          previous frame, or partial refreshes used up the ghosting
+ *          budget, a full refresh runs instead. The window is written
+ *          to the 0x26 RAM too once the update is done, so the frame buffer
+ *          must not be redrawn before the done handler runs.
+ *
+ * @param[in] frame_buffer_black  Black plane.
+ * @param[in] p_window            Window of the canvas that changed, NULL to
+ *                                find it by comparing with the previous frame.
+ * @param[in] done_handler        Called once the panel is back asleep, may be NULL.
+ *
+ * @return NRF_SUCCESS, NRF_ERROR_BUSY if a refresh is already running or
+ *         NRF_ERROR_NOT_SUPPORTED if the panel has no partial waveform.
+ */
+ret_code_t epd_refresh_start_region(const unsigned char *frame_buffer_black,
+                                    const EPD_Window *p_window,
+                                    epd_refresh_done_handler_t done_handler);
+
+/**@brief Function for running a full refresh with the full waveform.
+ *
+ * @details Clears the ghosting partial refreshes leave behind. Usually given
+ *          the frame already on screen, when the panel is not in use.
+ *
+ * @param[in] frame_buffer_black  Black plane.
+ * @param[in] p_red               Red plane, NULL if there is no red.
+ * @param[in] done_handler        Called once the panel is back asleep, may be NULL.
+ *
+ * @return NRF_SUCCESS, or NRF_ERROR_BUSY if a refresh is already running.
+ */
+ret_code_t epd_refresh_clean(const unsigned char *frame_buffer_black,
+                             const EPD_RedPlane *p_red,
+                             epd_refresh_done_handler_t done_handler);
+
+/**@brief Function for setting the handler called once the frame is uploaded.
+ *
+ * @details From then on the running refresh no longer reads the frame
+ *          buffers, and the next frame can be drawn into them while the
+ *          panel runs its waveform. Not called for a partial refresh
+ *          without RAM ping-pong, which reads the window again after the
+ *          update: the buffers are free once the done handler runs.
+ *
+ * @param[in] release_handler  Handler, NULL to disable.
+ */
+void epd_refresh_release_handler_set(epd_refresh_done_handler_t release_handler);
+
+/**@brief Function for starting a refresh with a streamed frame.
+ *
+ * @details The panel is woken up, then the frame is written to its RAM as
+ *          it arrives with epd_refresh_stream_write(), with no frame buffer.
+ *          See EPD_Stream for the format. The refresh is a full one with
+ *          the full waveform, whatever epd_refresh_waveform_set() picked.
+ *
+ * @param[in] p_window       Window of the canvas streamed, NULL for the whole canvas.
+ * @param[in] ready_handler  Called once the panel takes data, may be NULL.
+ *
+ * @return NRF_SUCCESS, NRF_ERROR_BUSY if a refresh is already running or
+ *         NRF_ERROR_INVALID_PARAM if the window is not inside the canvas.
+ */
+ret_code_t epd_refresh_stream_begin(const EPD_Window *p_window,
+                                    epd_refresh_done_handler_t ready_handler);
+
+/**@brief Function for writing a chunk of the streamed frame.
+ *
+ * @details The chunk is sent before the function returns, it can come
+ *          straight from a BLE write event.
+ *
+ * @param[in] p_data  Chunk, may split runs anywhere.
+ * @param[in] len     Length of the chunk.
+ *
+ * @return NRF_SUCCESS, NRF_ERROR_INVALID_STATE if the panel does not take
+ *         data yet or NRF_ERROR_INVALID_DATA if the chunk runs past the window.
+ */
+ret_code_t epd_refresh_stream_write(const uint8_t *p_data, uint16_t len);
+
+/**@brief Function for ending the stream and refreshing the panel.
+ *
+ * @param[in] done_handler  Called once the panel is back asleep, may be NULL.
+ *
+ * @return NRF_SUCCESS, NRF_ERROR_INVALID_STATE if no stream is open or
+ *         NRF_ERROR_INVALID_LENGTH if the stream did not fill the window.
+ *         The panel is put back to sleep without a refresh then, the
+ *         done handler still runs once it is asleep.
+ */
+ret_code_t epd_refresh_stream_end(epd_refresh_done_handler_t done_handler);
+
+/**@brief Function for checking if partial refreshes left ghosting behind.
+ *
+ * @return true if there was a partial refresh since the last full one.
+ */
+bool epd_refresh_ghosting_get(void);
+
+/**@brief Function for setting the waveform profile of the next full refreshes.
+ *
+ * @details A short waveform is loaded after the wake up, partial refreshes
+ *          keep using the mode 2 waveform. See EPD_WaveformSelect().
+ *
+ * @param[in] waveform  Waveform profile.
+ */
+void epd_refresh_waveform_set(EPD_Waveform waveform);
+
+epd_refresh_state_t epd_refresh_state_get(void);
+
+/**@brief Function for getting the result of the last refresh.
+ *
+ * @return NRF_SUCCESS, or NRF_ERROR_TIMEOUT if BUSY got stuck. The panel
+ *         was power cycled then and the screen may show anything.
+ */
+ret_code_t epd_refresh_result_get(void);
+
+/**@brief Function for getting the phase timings of a profile.
+ *
+ * @param[in] profile  EPD_Waveform of a full refresh, or EPD_PROFILE_PARTIAL.
+ *
+ * @return Statistics since boot.
+ */
+const epd_refresh_stats_t *epd_refresh_stats_get(uint8_t profile);
+
+/**@brief Function for logging the phase timings of all profiles.
+ */
+void epd_refresh_stats_log(void);
+
+#endif /* EPD_REFRESH_H */
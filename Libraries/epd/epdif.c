@@ -5,6 +5,7 @@
  * @par
 */
 
+#include <string.h>
 #include "nrf_gpio.h"
 #include "nrf_delay.h"
 #include "nrf_log.h"
@@ -35,7 +36,30 @@ EPD_Pin pins[4];
 
 static const nrf_drv_spi_t spi = NRF_DRV_SPI_INSTANCE(WSEPD_SPI_INSTANCE);
 
+static EPD_SpiStats spi_stats;
+static uint8_t spi_bounce[EPD_SPI_BOUNCE_LEN];
+
+static const EPD_Transport *p_transport = &EPD_TRANSPORT_DEFAULT;
+
+/**
+ *  @brief: pick the transport backend, before epd_spi_init()
+ */
+void EpdTransportSelect(const EPD_Transport *transport)
+{
+  p_transport = transport;
+}
+
 ret_code_t epd_spi_init(void)
+{
+  return p_transport->init();
+}
+
+void epd_spi_uninit(void)
+{
+  p_transport->uninit();
+}
+
+static ret_code_t spi_init(void)
 {
   ret_code_t err_code;
 
@@ -43,29 +67,32 @@ ret_code_t epd_spi_init(void)
 
   spi_config.sck_pin  = EPD_SPI_SCK_PIN;
   spi_config.mosi_pin = EPD_SPI_MOSI_PIN;
-  spi_config.ss_pin = EPD_SPI_CS_PIN;
+  // CS is driven here so a batch can hold it low over many transfers
+  spi_config.ss_pin = NRF_DRV_SPI_PIN_NOT_USED;
   spi_config.frequency = NRF_DRV_SPI_FREQ_1M;
 
   err_code = nrf_drv_spi_init(&spi, &spi_config, NULL, NULL);
   return err_code;
 }
 
+static void spi_uninit(void)
+{
+  nrf_drv_spi_uninit(&spi);
+}
+
 void EPD_GPIO_Init(void)
 {
   nrf_gpio_pin_dir_set(EPD_DC_PIN, NRF_GPIO_PIN_DIR_OUTPUT);
   nrf_gpio_pin_dir_set(EPD_RST_PIN, NRF_GPIO_PIN_DIR_OUTPUT);
-  //nrf_gpio_pin_dir_set(EPD_SPI_CS_PIN, NRF_GPIO_PIN_DIR_OUTPUT);
+  nrf_gpio_pin_dir_set(EPD_SPI_CS_PIN, NRF_GPIO_PIN_DIR_OUTPUT);
   nrf_gpio_cfg_input(SPI_BUSY_PIN, NRF_GPIO_PIN_PULLUP);
 
   nrf_gpio_pin_write(EPD_DC_PIN, 0);
   nrf_gpio_pin_write(EPD_RST_PIN, 0);
-  //nrf_gpio_pin_write(EPD_SPI_CS_PIN, 0);
-  //gpio_pin_set(epaper_gpio, EPD_BUSY_PIN, 0);
-  int value = nrf_gpio_pin_read(EPD_BUSY_PIN);
-  //printk("Busy pin: %d\n", value);
+  nrf_gpio_pin_write(EPD_SPI_CS_PIN, 1);
 }
 
-void EpdDigitalWriteCallback(int pin_num, int value)
+void EpdGpioWrite(int pin_num, int value)
 {
   if (value == HIGH)
   {
@@ -77,7 +104,7 @@ void EpdDigitalWriteCallback(int pin_num, int value)
   }
 }
 
-int EpdDigitalReadCallback(int pin_num)
+int EpdGpioRead(int pin_num)
 {
   uint32_t value;
   value = nrf_gpio_pin_read(pins[pin_num].pin);
@@ -99,20 +126,216 @@ int EpdDigitalReadCallback(int pin_num)
   }
 }
 
-void EpdDelayMsCallback(unsigned int delaytime)
+static void spi_delay_ms(unsigned int delaytime)
 {
   nrf_delay_ms(delaytime);
 }
 
-void EpdSpiTransferCallback(const void *data, size_t size)
+/**
+ *  @brief: send a block of any length, one EasyDMA transfer per
+ *          EPD_SPI_MAX_XFER_LEN bytes. Blocks that live in flash are
+ *          copied through a small RAM buffer first. CS is left to the caller.
+ */
+static void spi_write(const uint8_t *p_data, size_t size)
+{
+  bool in_ram = nrfx_is_in_ram(p_data);
+  size_t chunk;
+
+  while (size > 0)
+  {
+    chunk = (size > EPD_SPI_MAX_XFER_LEN) ? EPD_SPI_MAX_XFER_LEN : size;
+    if (!in_ram)
+    {
+      chunk = (chunk > EPD_SPI_BOUNCE_LEN) ? EPD_SPI_BOUNCE_LEN : chunk;
+      memcpy(spi_bounce, p_data, chunk);
+    }
+
+    APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, in_ram ? p_data : spi_bounce, chunk, NULL, 0));
+
+    EpdSpiStatsAdd(chunk);
+    p_data += chunk;
+    size -= chunk;
+  }
+}
+
+static void spi_transfer(const void *data, size_t size)
 {
   nrf_gpio_pin_write(pins[CS_PIN].pin, 0);
-  
-  APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, data, size, NULL, 0));
+  spi_write(data, size);
+  nrf_gpio_pin_write(pins[CS_PIN].pin, 1);
+}
+
+/**
+ *  @brief: send the same byte size times. The RAM buffer is filled once
+ *          and EasyDMA reads it again for every transfer, so the CPU only
+ *          restarts the transfers and no frame sized buffer is needed.
+ */
+static void spi_fill(uint8_t value, size_t size)
+{
+  size_t chunk;
+
+  memset(spi_bounce, value, (size > sizeof(spi_bounce)) ? sizeof(spi_bounce) : size);
+
+  nrf_gpio_pin_write(pins[CS_PIN].pin, 0);
+
+  while (size > 0)
+  {
+    chunk = (size > sizeof(spi_bounce)) ? sizeof(spi_bounce) : size;
+
+    APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, spi_bounce, chunk, NULL, 0));
+
+    EpdSpiStatsAdd(chunk);
+    size -= chunk;
+  }
 
   nrf_gpio_pin_write(pins[CS_PIN].pin, 1);
 }
 
+/**
+ *  @brief: send a batch of sequence records with CS held low,
+ *          only DC switches between command and data
+ */
+static void spi_sequence(const uint8_t *records, size_t size)
+{
+  const uint8_t *p_end = records + size;
+  uint8_t len;
+
+  nrf_gpio_pin_write(pins[CS_PIN].pin, 0);
+
+  while (records < p_end)
+  {
+    len = records[1] & EPD_SEQ_LEN_MASK;
+    nrf_gpio_pin_write(pins[DC_PIN].pin, 0);
+    spi_write(records, 1);
+    if (len > 0)
+    {
+      nrf_gpio_pin_write(pins[DC_PIN].pin, 1);
+      spi_write(&records[2], len);
+    }
+    records += 2 + len;
+  }
+
+  nrf_gpio_pin_write(pins[CS_PIN].pin, 1);
+}
+
+const EPD_Transport epd_transport_spi = {
+  spi_init,
+  spi_uninit,
+  EpdGpioWrite,
+  EpdGpioRead,
+  spi_delay_ms,
+  spi_transfer,
+  spi_fill,
+  spi_sequence,
+  NULL,  // spi_write returns once the block is out
+};
+
+void EpdDigitalWriteCallback(int pin_num, int value)
+{
+  p_transport->digital_write(pin_num, value);
+}
+
+int EpdDigitalReadCallback(int pin_num)
+{
+  return p_transport->digital_read(pin_num);
+}
+
+void EpdDelayMsCallback(unsigned int delaytime)
+{
+  p_transport->delay_ms(delaytime);
+}
+
+void EpdSpiTransferCallback(const void *data, size_t size)
+{
+  p_transport->transfer(data, size);
+}
+
+void EpdSpiFillCallback(uint8_t value, size_t size)
+{
+  p_transport->fill(value, size);
+}
+
+void EpdSpiFlushCallback(void)
+{
+  if (p_transport->flush != NULL)
+  {
+    p_transport->flush();
+  }
+}
+
+/**
+ *  @brief: send the records of a sequence up to the first one that waits
+ *          for BUSY, as one batch. Returns the record after it, the caller
+ *          waits for BUSY and calls again, or NULL once the sequence ended.
+ */
+const uint8_t *EpdSpiSequenceCallback(const uint8_t *sequence)
+{
+  const uint8_t *p_next = sequence;
+  bool wait = false;
+
+  while (p_next[1] != EPD_SEQ_END && !wait)
+  {
+    wait = (p_next[1] & EPD_SEQ_WAIT) != 0;
+    p_next += 2 + (p_next[1] & EPD_SEQ_LEN_MASK);
+  }
+
+  if (p_next != sequence)
+  {
+    if (p_transport->sequence != NULL)
+    {
+      p_transport->sequence(sequence, p_next - sequence);
+    }
+    else
+    {
+      EpdSequenceSend(sequence, p_next - sequence);
+    }
+  }
+
+  return wait ? p_next : NULL;
+}
+
+/**
+ *  @brief: send sequence records one block at a time, for backends
+ *          without a batched sequence
+ */
+void EpdSequenceSend(const uint8_t *records, size_t size)
+{
+  const uint8_t *p_end = records + size;
+  uint8_t len;
+
+  while (records < p_end)
+  {
+    len = records[1] & EPD_SEQ_LEN_MASK;
+    p_transport->digital_write(DC_PIN, LOW);
+    p_transport->transfer(records, 1);
+    if (len > 0)
+    {
+      p_transport->digital_write(DC_PIN, HIGH);
+      p_transport->transfer(&records[2], len);
+    }
+    records += 2 + len;
+  }
+}
+
+/**
+ *  @brief: count one transfer of size bytes, called by the backends
+ */
+void EpdSpiStatsAdd(size_t size)
+{
+  spi_stats.transactions++;
+  spi_stats.bytes += size;
+}
+
+void EpdSpiStatsGet(EPD_SpiStats *p_stats)
+{
+  *p_stats = spi_stats;
+}
+
+void EpdSpiStatsReset(void)
+{
+  memset(&spi_stats, 0, sizeof(spi_stats));
+}
+
 int EpdInitCallback(void)
 {
   pins[CS_PIN] = epd_cs_pin;
@@ -10,7 +10,16 @@
 #ifndef EPDIF_H
 #define EPDIF_H
 
+#ifdef EPD_TRACE_HOST
+// Host build of the trace backend, no SDK: the few SDK names used here
+#include <stddef.h>
+#include <stdint.h>
+typedef uint32_t ret_code_t;
+#define NRF_SUCCESS         0
+#define NRF_ERROR_INTERNAL  3
+#else
 #include "app_error.h"
+#endif
 
 #define EPD_BUSY_PIN        4
 #define EPD_RST_PIN         5
@@ -35,12 +44,57 @@
 
 #define WSEPD_SPI_INSTANCE  0
 
+// nrf_drv_spi takes 8-bit buffer lengths, so longer blocks are split
+#define EPD_SPI_MAX_XFER_LEN  255
+// EasyDMA can only read RAM, data held in flash is staged through this.
+// Constant fills reuse it as the repeated pattern.
+#define EPD_SPI_BOUNCE_LEN    128
+
+// Command sequences: records of command, control byte, data. The control
+// byte holds the data length, EPD_SEQ_WAIT to wait for BUSY after the
+// record, or EPD_SEQ_END alone to end the sequence.
+#define EPD_SEQ_WAIT  0x80
+#define EPD_SEQ_END   0x40
+#define EPD_SEQ_LEN_MASK 0x3F
+
 typedef struct
 {
   int pin;
 } EPD_Pin;
 
+/* Transport backend, everything epd.c needs from the hardware */
+typedef struct
+{
+  ret_code_t (*init)(void);
+  void (*uninit)(void);                            // Release the peripheral between updates
+  void (*digital_write)(int pin, int value);
+  int (*digital_read)(int pin);
+  void (*delay_ms)(unsigned int delaytime);
+  void (*transfer)(const void *data, size_t size); // May return before the block is out
+  void (*fill)(uint8_t value, size_t size);        // Send size copies of value
+  void (*sequence)(const uint8_t *records, size_t size); // Sequence records, no end record
+                                                         // and no BUSY wait. May be NULL.
+  void (*flush)(void);                             // Wait until the last block is out,
+                                                   // NULL if transfers block
+} EPD_Transport;
+
+extern const EPD_Transport epd_transport_spi;        // Blocking nrf_drv_spi, epdif.c
+extern const EPD_Transport epd_transport_spim_async; // SPIM EasyDMA under interrupts, epdif_spim.c
+extern const EPD_Transport epd_transport_trace;      // No panel, records the byte stream, epdif_trace.c
+
+#ifndef EPD_TRANSPORT_DEFAULT
+#define EPD_TRANSPORT_DEFAULT epd_transport_spi
+#endif
+
+typedef struct
+{
+  uint32_t transactions;  // SPI transfers issued to the driver
+  uint32_t bytes;         // Bytes clocked out to the panel
+} EPD_SpiStats;
+
+void EpdTransportSelect(const EPD_Transport *transport);
 ret_code_t epd_spi_init(void);
+void epd_spi_uninit(void);
 void EPD_GPIO_Init(void);
 
 int EpdInitCallback(void);
@@ -48,5 +102,16 @@ void EpdDigitalWriteCallback(int pin, int value);
 int EpdDigitalReadCallback(int pin);
 void EpdDelayMsCallback(unsigned int delaytime);
 void EpdSpiTransferCallback(const void *, size_t);
+void EpdSpiFillCallback(uint8_t value, size_t size);
+const uint8_t *EpdSpiSequenceCallback(const uint8_t *sequence);
+void EpdSpiFlushCallback(void);
+void EpdSpiStatsGet(EPD_SpiStats *p_stats);
+void EpdSpiStatsReset(void);
+
+/* Shared by the backends */
+void EpdGpioWrite(int pin, int value);
+int EpdGpioRead(int pin);
+void EpdSpiStatsAdd(size_t size);
+void EpdSequenceSend(const uint8_t *records, size_t size);
 
 #endif /* EPDIF_H */
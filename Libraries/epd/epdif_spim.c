@@ -0,0 +1,251 @@
+/** @file epdif_spim.c
+ *
+ * @brief Implements the SPIM transport backend, blocks are sent by EasyDMA
+ *        and chained from the SPIM interrupt so the CPU is free meanwhile
+ *
+ * @par
+*/
+
+#include <string.h>
+#include "nrf_delay.h"
+#include "app_util_platform.h"
+#include "nrf_drv_spi.h"
+#include "epdif.h"
+
+// Blocks up to this size are copied, callers pass them from the stack
+#define EPD_SPIM_COPY_LEN  16
+// Sequences in RAM up to this size are copied and sent under interrupts,
+// longer ones go block by block
+#define EPD_SPIM_SEQ_LEN   64
+
+typedef enum
+{
+  SPIM_BLOCK_RAM,    // Sent in place
+  SPIM_BLOCK_FLASH,  // Staged through the bounce buffer chunk by chunk
+  SPIM_BLOCK_FILL    // Bounce buffer holds the value, sent again and again
+} spim_block_t;
+
+static const nrf_drv_spi_t spim = NRF_DRV_SPI_INSTANCE(WSEPD_SPI_INSTANCE);
+
+static uint8_t m_bounce[EPD_SPI_BOUNCE_LEN];
+static volatile bool m_busy;
+static spim_block_t m_block;
+static const uint8_t *mp_data;
+static size_t m_remaining;
+static uint8_t m_seq[EPD_SPIM_SEQ_LEN];
+static const uint8_t *mp_seq;      // Record in flight
+static const uint8_t *mp_seq_end;
+static bool m_seq_data;            // Data of the record in flight is next
+
+static void spim_block_start(spim_block_t block, const uint8_t *p_data, size_t size);
+
+/**@brief Function for starting the next chunk of the block in flight.
+ */
+static void spim_chunk_start(void)
+{
+  const uint8_t *p_tx = mp_data;
+  size_t chunk = (m_remaining > EPD_SPI_MAX_XFER_LEN) ? EPD_SPI_MAX_XFER_LEN : m_remaining;
+
+  if (m_block != SPIM_BLOCK_RAM)
+  {
+    chunk = (chunk > sizeof(m_bounce)) ? sizeof(m_bounce) : chunk;
+    p_tx = m_bounce;
+  }
+  if (m_block == SPIM_BLOCK_FLASH)
+  {
+    memcpy(m_bounce, mp_data, chunk);
+  }
+
+  if (m_block != SPIM_BLOCK_FILL)
+  {
+    mp_data += chunk;
+  }
+  m_remaining -= chunk;
+
+  EpdSpiStatsAdd(chunk);
+  APP_ERROR_CHECK(nrf_drv_spi_transfer(&spim, p_tx, chunk, NULL, 0));
+}
+
+/**@brief Function for starting the next block of the sequence in flight.
+ *
+ * @details Command and data of a record are two blocks. The SPIM interrupt
+ *          at the end of each block runs this step, which switches DC and
+ *          starts the next block: one or two interrupts per record, with
+ *          no wait in thread mode. CS goes high after the last block.
+ */
+static void spim_seq_step(void)
+{
+  const uint8_t *p_record = mp_seq;
+  uint8_t len = p_record[1] & EPD_SEQ_LEN_MASK;
+  spim_block_t block = nrfx_is_in_ram(p_record) ? SPIM_BLOCK_RAM : SPIM_BLOCK_FLASH;
+
+  // The next step may run from the interrupt before this one returns
+  if (!m_seq_data)
+  {
+    EpdGpioWrite(DC_PIN, LOW);
+    m_seq_data = (len > 0);
+    if (!m_seq_data)
+    {
+      mp_seq += 2;
+    }
+    spim_block_start(block, p_record, 1);
+  }
+  else
+  {
+    EpdGpioWrite(DC_PIN, HIGH);
+    m_seq_data = false;
+    mp_seq += 2 + len;
+    spim_block_start(block, &p_record[2], len);
+  }
+}
+
+static void spim_evt_handler(nrf_drv_spi_evt_t const *p_event, void *p_context)
+{
+  UNUSED_PARAMETER(p_event);
+  UNUSED_PARAMETER(p_context);
+
+  if (m_remaining > 0)
+  {
+    spim_chunk_start();
+    return;
+  }
+
+  if (mp_seq != mp_seq_end)
+  {
+    spim_seq_step();
+    return;
+  }
+  EpdGpioWrite(CS_PIN, HIGH);
+  m_busy = false;
+}
+
+/**@brief Function for waiting until the block in flight is out.
+ */
+static void spim_flush(void)
+{
+  while (m_busy)
+  {
+    __WFE();
+  }
+}
+
+static void spim_block_start(spim_block_t block, const uint8_t *p_data, size_t size)
+{
+  if (size == 0)
+  {
+    return;
+  }
+
+  m_block = block;
+  mp_data = p_data;
+  m_remaining = size;
+  m_busy = true;
+
+  EpdGpioWrite(CS_PIN, LOW);
+  spim_chunk_start();
+}
+
+static ret_code_t spim_init(void)
+{
+  nrf_drv_spi_config_t spi_config = NRF_DRV_SPI_DEFAULT_CONFIG;
+
+  spi_config.sck_pin  = EPD_SPI_SCK_PIN;
+  spi_config.mosi_pin = EPD_SPI_MOSI_PIN;
+  // CS is driven here, it stays low over all the records of a sequence
+  spi_config.ss_pin = NRF_DRV_SPI_PIN_NOT_USED;
+  spi_config.frequency = NRF_DRV_SPI_FREQ_1M;
+  // Above the app_timer and GPIOTE handlers, which wait here for the bus
+  spi_config.irq_priority = APP_IRQ_PRIORITY_MID;
+
+  return nrf_drv_spi_init(&spim, &spi_config, spim_evt_handler, NULL);
+}
+
+static void spim_uninit(void)
+{
+  spim_flush();
+  nrf_drv_spi_uninit(&spim);
+}
+
+static void spim_digital_write(int pin, int value)
+{
+  // DC and RST must not change under a block still going out
+  spim_flush();
+  EpdGpioWrite(pin, value);
+}
+
+static int spim_digital_read(int pin)
+{
+  spim_flush();
+  return EpdGpioRead(pin);
+}
+
+static void spim_delay_ms(unsigned int delaytime)
+{
+  spim_flush();
+  nrf_delay_ms(delaytime);
+}
+
+/**
+ *  @brief: start sending a block and return. Blocks over EPD_SPIM_COPY_LEN
+ *          in RAM are read in place, they must stay unchanged until the
+ *          next call into the transport.
+ */
+static void spim_transfer(const void *data, size_t size)
+{
+  spim_flush();
+
+  if (!nrfx_is_in_ram(data))
+  {
+    spim_block_start(SPIM_BLOCK_FLASH, data, size);
+  }
+  else if (size <= EPD_SPIM_COPY_LEN)
+  {
+    memcpy(m_bounce, data, size);
+    spim_block_start(SPIM_BLOCK_RAM, m_bounce, size);
+  }
+  else
+  {
+    spim_block_start(SPIM_BLOCK_RAM, data, size);
+  }
+}
+
+static void spim_fill(uint8_t value, size_t size)
+{
+  spim_flush();
+
+  memset(m_bounce, value, sizeof(m_bounce));
+  spim_block_start(SPIM_BLOCK_FILL, m_bounce, size);
+}
+
+static void spim_sequence(const uint8_t *records, size_t size)
+{
+  spim_flush();
+
+  if (nrfx_is_in_ram(records))
+  {
+    if (size > sizeof(m_seq))
+    {
+      EpdSequenceSend(records, size);
+      return;
+    }
+    memcpy(m_seq, records, size);
+    records = m_seq;
+  }
+
+  mp_seq_end = records + size;
+  mp_seq = records;
+  m_seq_data = false;
+  spim_seq_step();
+}
+
+const EPD_Transport epd_transport_spim_async = {
+  spim_init,
+  spim_uninit,
+  spim_digital_write,
+  spim_digital_read,
+  spim_delay_ms,
+  spim_transfer,
+  spim_fill,
+  spim_sequence,
+  spim_flush,
+};
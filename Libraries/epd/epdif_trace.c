@@ -0,0 +1,133 @@
+/** @file epdif_trace.c
+ *
+ * @brief Implements the trace transport backend. There is no panel, the
+ *        command/data stream is recorded so epd.c can be checked and its
+ *        SPI traffic counted without one. Built with EPD_TRACE_HOST the stream goes
+ *        to the file EPD_TRACE_FILE, otherwise to the log.
+ *
+ *        On the host it runs under epd.c and epdif.c with the SDK stubbed,
+ *        test/epd_trace_test.c checks the stream, see make -C test.
+ *
+ * @par
+ * One line per block: "C" command or "D" data followed by the bytes in hex,
+ * "F" fill value and length, "W" delay in ms, "P" pin and level.
+*/
+
+#include "epdif.h"
+#include "epd_panel.h"
+
+#ifdef EPD_TRACE_HOST
+#include <stdio.h>
+#ifndef EPD_TRACE_FILE
+#define EPD_TRACE_FILE "epd_trace.txt"
+#endif
+static FILE *mp_trace_file;
+#else
+#include "nrf_log.h"
+#endif
+
+static int m_dc = LOW;
+
+static ret_code_t trace_init(void)
+{
+#ifdef EPD_TRACE_HOST
+  // Opened once, the trace runs on across power cycles
+  if (mp_trace_file == NULL)
+  {
+    mp_trace_file = fopen(EPD_TRACE_FILE, "w");
+  }
+  if (mp_trace_file == NULL)
+  {
+    return NRF_ERROR_INTERNAL;
+  }
+#endif
+  return NRF_SUCCESS;
+}
+
+static void trace_uninit(void)
+{
+#ifdef EPD_TRACE_HOST
+  fflush(mp_trace_file);
+#else
+  NRF_LOG_DEBUG("EPD transport released");
+#endif
+}
+
+static void trace_digital_write(int pin, int value)
+{
+  if (pin == DC_PIN)
+  {
+    m_dc = value;
+    return;
+  }
+#ifdef EPD_TRACE_HOST
+  fprintf(mp_trace_file, "P %d %d\n", pin, value);
+#else
+  NRF_LOG_DEBUG("EPD pin %d: %d", pin, value);
+#endif
+}
+
+static int trace_digital_read(int pin)
+{
+  // BUSY always idle, whatever level the panel drives while busy
+  if (pin == BUSY_PIN)
+  {
+    return (epd_panels[EPD_PANEL].busy_level == HIGH) ? LOW : HIGH;
+  }
+  return LOW;
+}
+
+static void trace_delay_ms(unsigned int delaytime)
+{
+#ifdef EPD_TRACE_HOST
+  fprintf(mp_trace_file, "W %u\n", delaytime);
+#else
+  NRF_LOG_DEBUG("EPD wait %d ms", delaytime);
+#endif
+}
+
+static void trace_transfer(const void *data, size_t size)
+{
+  EpdSpiStatsAdd(size);
+#ifdef EPD_TRACE_HOST
+  const uint8_t *p_data = data;
+
+  fputc((m_dc == LOW) ? 'C' : 'D', mp_trace_file);
+  while (size-- > 0)
+  {
+    fprintf(mp_trace_file, " %02X", *p_data++);
+  }
+  fputc('\n', mp_trace_file);
+#else
+  if (m_dc == LOW)
+  {
+    NRF_LOG_DEBUG("EPD command 0x%02x", *(const uint8_t *)data);
+  }
+  else
+  {
+    NRF_LOG_DEBUG("EPD data %d bytes", size);
+  }
+#endif
+}
+
+static void trace_fill(uint8_t value, size_t size)
+{
+  EpdSpiStatsAdd(size);
+#ifdef EPD_TRACE_HOST
+  fprintf(mp_trace_file, "F %02X %u\n", value, (unsigned)size);
+#else
+  NRF_LOG_DEBUG("EPD fill 0x%02x, %d bytes", value, size);
+#endif
+}
+
+const EPD_Transport epd_transport_trace = {
+  trace_init,
+  trace_uninit,
+  trace_digital_write,
+  trace_digital_read,
+  trace_delay_ms,
+  trace_transfer,
+  trace_fill,
+  NULL,  // One line per block shows the sequences as they are
+  NULL,
+};
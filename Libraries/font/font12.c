@@ -2252,6 +2252,7 @@ sFONT Font12 = {
 	Font12_Table,
 	7,	/* Width */
 	12, /* Height */
+	FONT_COLUMNS_TABLE(Font12_Columns),
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
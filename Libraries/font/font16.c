@@ -2893,6 +2893,7 @@ sFONT Font16 = {
 	Font16_Table,
 	11, /* Width */
 	16, /* Height */
+	FONT_COLUMNS_TABLE(Font16_Columns),
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
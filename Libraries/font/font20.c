@@ -3529,6 +3529,7 @@ sFONT Font20 = {
 	Font20_Table,
 	14, /* Width */
 	20, /* Height */
+	FONT_COLUMNS_TABLE(Font20_Columns),
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
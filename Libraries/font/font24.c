@@ -4167,6 +4167,7 @@ sFONT Font24 = {
 	Font24_Table,
 	17, /* Width */
 	24, /* Height */
+	FONT_COLUMNS_TABLE(Font24_Columns),
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
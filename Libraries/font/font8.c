@@ -1612,6 +1612,7 @@ sFONT Font8 = {
 	Font8_Table,
 	5, /* Width */
 	8, /* Height */
+	FONT_COLUMNS_TABLE(Font8_Columns),
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+"""Generate fonts_columns.c, the glyph tables of font8.c ... font24.c by columns.
+
+The tag canvas is transposed on the image memory: a glyph column is a run of
+memory bits and a glyph row is not. Paint_DrawChar() copies these columns
+instead of transposing every glyph while it draws.
+
+Each glyph is its columns left to right, each column (Height + 7) / 8 bytes
+from the top row at the msb of the first byte. A mirrored canvas reverses
+the column while drawing.
+
+Only ' ' to '~' get columns, FONT_COLUMNS_FIRST to FONT_COLUMNS_LAST of
+fonts.h: the tables hold 160 glyphs but the text of the screens is ASCII.
+The rest, the degree sign at 0xB0 among them, is transposed while drawn.
+
+Run it again after a font table changed:
+
+    python3 fontgen.py [-o fonts_columns.c] [font8.c ...]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FONTS = ["font8.c", "font12.c", "font16.c", "font20.c", "font24.c"]
+FIRST = " "
+LAST = "~"
+
+
+def parse_font(path):
+    with open(path, encoding="latin-1") as f:
+        text = f.read()
+
+    table = re.search(r"const\s+uint8_t\s+(\w+)_Table\s*\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    font = re.search(r"sFONT\s+(\w+)\s*=\s*\{\s*\w+_Table\s*,\s*(\d+)\s*,[^,]*?(\d+)", text, re.S)
+    if table is None or font is None:
+        sys.exit("%s: no font table" % path)
+
+    data = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})", re.sub(r"//.*", "", table.group(2)))]
+    return table.group(1), int(font.group(2)), int(font.group(3)), data
+
+
+def glyph_columns(glyph, width, height):
+    row_bytes = (width + 7) // 8
+    column_bytes = (height + 7) // 8
+    columns = []
+
+    for x in range(width):
+        column = [0] * column_bytes
+        for y in range(height):
+            if glyph[y * row_bytes + x // 8] & (0x80 >> (x % 8)):
+                column[y // 8] |= 0x80 >> (y % 8)
+        columns += column
+    return columns
+
+
+def generate(paths):
+    out = ["#include \"fonts.h\"",
+           "",
+           "//",
+           "//  Generated by fontgen.py from %s, do not edit" % ", ".join(os.path.basename(p) for p in paths),
+           "//  Glyph columns left to right, each from the top row at the msb",
+           "//  '%s' to '%s' only, FONT_COLUMNS_FIRST to FONT_COLUMNS_LAST" % (FIRST, LAST),
+           "//",
+           "",
+           "#if FONT_COLUMNS",
+           ""]
+
+    for path in paths:
+        name, width, height, data = parse_font(path)
+        glyph_size = height * ((width + 7) // 8)
+        glyphs = ord(LAST) - ord(FIRST) + 1
+        if len(data) % glyph_size != 0 or len(data) < glyphs * glyph_size:
+            sys.exit("%s: table is not whole glyphs" % path)
+
+        out.append("const uint8_t %s_Columns[] =" % name)
+        out.append("\t{")
+        for i in range(glyphs):
+            columns = glyph_columns(data[i * glyph_size:(i + 1) * glyph_size], width, height)
+            out.append("\t\t%s // '%s'" % (" ".join("0x%02X," % v for v in columns), chr(ord(FIRST) + i)))
+        out.append("};")
+        out.append("")
+
+    out.append("#endif /* FONT_COLUMNS */")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", default=os.path.join(here, "fonts_columns.c"))
+    parser.add_argument("fonts", nargs="*", default=[os.path.join(here, f) for f in FONTS])
+    args = parser.parse_args()
+
+    text = generate(args.fonts)
+    with open(args.output, "w", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
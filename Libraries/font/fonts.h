@@ -12,6 +12,22 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
+#include <stddef.h>
+
+//Glyph tables by columns as well, for canvases transposed on the image
+//memory. Generated into fonts_columns.c by fontgen.py, for the ASCII
+//glyphs only: the others are transposed while drawn
+#ifndef FONT_COLUMNS
+#define FONT_COLUMNS 1
+#endif
+#define FONT_COLUMNS_FIRST ' '
+#define FONT_COLUMNS_LAST  '~'
+
+#if FONT_COLUMNS
+#define FONT_COLUMNS_TABLE(table) (table)
+#else
+#define FONT_COLUMNS_TABLE(table) NULL
+#endif
 
 //ASCII
 typedef struct _tFont
@@ -19,6 +35,7 @@ typedef struct _tFont
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  const uint8_t *columns; //NULL without FONT_COLUMNS
   
 } sFONT;
 
@@ -47,6 +64,12 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern const uint8_t Font24_Columns[];
+extern const uint8_t Font20_Columns[];
+extern const uint8_t Font16_Columns[];
+extern const uint8_t Font12_Columns[];
+extern const uint8_t Font8_Columns[];
+
 extern cFONT Font12CN;
 extern cFONT Font24CN;
 
@@ -0,0 +1,506 @@
+#include "fonts.h"
+
+//
+//  Generated by fontgen.py from font8.c, font12.c, font16.c, font20.c, font24.c, do not edit
+//  Glyph columns left to right, each from the top row at the msb
+//  ' ' to '~' only, FONT_COLUMNS_FIRST to FONT_COLUMNS_LAST
+//
+
+#if FONT_COLUMNS
+
+const uint8_t Font8_Columns[] =
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+		0x00, 0x00, 0xF4, 0x00, 0x00, // '!'
+		0x00, 0xC0, 0x00, 0xC0, 0x00, // '"'
+		0x2A, 0x7C, 0xAA, 0x7C, 0xA8, // '#'
+		0x00, 0x24, 0xF6, 0x58, 0x00, // '$'
+		0x00, 0x10, 0xD0, 0x2C, 0x20, // '%'
+		0x00, 0x1C, 0x74, 0x4C, 0x44, // '&'
+		0x00, 0x00, 0xE0, 0x00, 0x00, // '''
+		0x00, 0x00, 0x7C, 0x82, 0x00, // '('
+		0x00, 0x82, 0x7C, 0x00, 0x00, // ')'
+		0x00, 0x50, 0xE0, 0x50, 0x00, // '*'
+		0x10, 0x10, 0x7C, 0x10, 0x10, // '+'
+		0x00, 0x00, 0x06, 0x08, 0x00, // ','
+		0x00, 0x10, 0x10, 0x10, 0x00, // '-'
+		0x00, 0x00, 0x04, 0x00, 0x00, // '.'
+		0x02, 0x0C, 0x70, 0x80, 0x00, // '/'
+		0x00, 0x78, 0x84, 0x78, 0x00, // '0'
+		0x04, 0x84, 0xFC, 0x04, 0x04, // '1'
+		0x00, 0x4C, 0xB4, 0x44, 0x00, // '2'
+		0x00, 0x44, 0x94, 0x68, 0x00, // '3'
+		0x00, 0x30, 0x54, 0xFC, 0x14, // '4'
+		0x00, 0xE8, 0xA4, 0x98, 0x00, // '5'
+		0x00, 0x7C, 0xA4, 0x98, 0x00, // '6'
+		0x00, 0xC0, 0x9C, 0xE0, 0x00, // '7'
+		0x00, 0x58, 0xA4, 0x58, 0x00, // '8'
+		0x00, 0x64, 0x94, 0xF8, 0x00, // '9'
+		0x00, 0x00, 0x24, 0x00, 0x00, // ':'
+		0x00, 0x00, 0x04, 0x28, 0x00, // ';'
+		0x10, 0x10, 0x28, 0x44, 0x00, // '<'
+		0x00, 0x50, 0x50, 0x50, 0x00, // '='
+		0x00, 0x44, 0x28, 0x10, 0x10, // '>'
+		0x00, 0x40, 0x94, 0x60, 0x00, // '?'
+		0x00, 0x7C, 0x82, 0x92, 0x7A, // '@'
+		0x0C, 0xB4, 0xD0, 0x34, 0x0C, // 'A'
+		0x84, 0xFC, 0xA4, 0xA4, 0x58, // 'B'
+		0x00, 0xF8, 0x84, 0xC4, 0x00, // 'C'
+		0x84, 0xFC, 0x84, 0x84, 0x78, // 'D'
+		0x84, 0xFC, 0xA4, 0x84, 0xCC, // 'E'
+		0x84, 0xFC, 0xA4, 0x80, 0xC0, // 'F'
+		0x00, 0xF8, 0x84, 0x9C, 0x10, // 'G'
+		0x84, 0xFC, 0xA4, 0x20, 0xFC, // 'H'
+		0x00, 0x84, 0xFC, 0x84, 0x00, // 'I'
+		0x00, 0x18, 0x84, 0xF8, 0x80, // 'J'
+		0x84, 0xFC, 0x30, 0xDC, 0x84, // 'K'
+		0x84, 0xFC, 0x84, 0x04, 0x0C, // 'L'
+		0xFC, 0xE4, 0x10, 0xE4, 0xFC, // 'M'
+		0x84, 0xFC, 0x64, 0x98, 0xFC, // 'N'
+		0x00, 0x78, 0x84, 0x84, 0x78, // 'O'
+		0x84, 0xFC, 0x94, 0x90, 0x60, // 'P'
+		0x00, 0x78, 0x84, 0x86, 0x7A, // 'Q'
+		0x84, 0xFC, 0x94, 0x90, 0x6C, // 'R'
+		0x00, 0xCC, 0xA4, 0xDC, 0x00, // 'S'
+		0xC0, 0x84, 0xFC, 0x84, 0xC0, // 'T'
+		0x80, 0xF8, 0x04, 0x84, 0xF8, // 'U'
+		0xC0, 0xB8, 0x04, 0x9C, 0xE0, // 'V'
+		0xF8, 0x84, 0x38, 0x84, 0xF8, // 'W'
+		0x84, 0xCC, 0x30, 0xCC, 0x84, // 'X'
+		0xC0, 0xA4, 0x1C, 0xA4, 0xC0, // 'Y'
+		0x00, 0xCC, 0x94, 0xA4, 0xCC, // 'Z'
+		0x00, 0x00, 0xFE, 0x82, 0x00, // '['
+		0x80, 0x60, 0x1C, 0x02, 0x00, // '\'
+		0x00, 0x82, 0xFE, 0x00, 0x00, // ']'
+		0x00, 0x20, 0xC0, 0x20, 0x00, // '^'
+		0x01, 0x01, 0x01, 0x01, 0x01, // '_'
+		0x00, 0x00, 0x80, 0x40, 0x00, // '`'
+		0x00, 0x0C, 0x2C, 0x3C, 0x04, // 'a'
+		0x84, 0xFC, 0x24, 0x24, 0x18, // 'b'
+		0x00, 0x3C, 0x24, 0x24, 0x00, // 'c'
+		0x00, 0x18, 0x24, 0xA4, 0xFC, // 'd'
+		0x00, 0x38, 0x34, 0x34, 0x00, // 'e'
+		0x00, 0x24, 0x7C, 0xA4, 0x00, // 'f'
+		0x00, 0x18, 0x25, 0x25, 0x3E, // 'g'
+		0x84, 0xFC, 0x24, 0x20, 0x1C, // 'h'
+		0x00, 0x24, 0xBC, 0x04, 0x00, // 'i'
+		0x00, 0x21, 0xA1, 0x3F, 0x00, // 'j'
+		0x84, 0xFC, 0x10, 0x3C, 0x24, // 'k'
+		0x00, 0x84, 0xFC, 0x04, 0x00, // 'l'
+		0x3C, 0x20, 0x1C, 0x20, 0x1C, // 'm'
+		0x24, 0x3C, 0x20, 0x20, 0x1C, // 'n'
+		0x00, 0x18, 0x24, 0x24, 0x18, // 'o'
+		0x21, 0x3F, 0x25, 0x24, 0x18, // 'p'
+		0x00, 0x18, 0x24, 0x25, 0x3F, // 'q'
+		0x00, 0x24, 0x3C, 0x24, 0x20, // 'r'
+		0x00, 0x04, 0x34, 0x28, 0x00, // 's'
+		0x20, 0x78, 0x24, 0x24, 0x08, // 't'
+		0x20, 0x38, 0x04, 0x24, 0x3C, // 'u'
+		0x20, 0x30, 0x0C, 0x0C, 0x30, // 'v'
+		0x38, 0x24, 0x18, 0x24, 0x38, // 'w'
+		0x00, 0x24, 0x18, 0x18, 0x24, // 'x'
+		0x20, 0x39, 0x07, 0x38, 0x20, // 'y'
+		0x00, 0x34, 0x2C, 0x34, 0x2C, // 'z'
+		0x00, 0x10, 0x7C, 0x82, 0x00, // '{'
+		0x00, 0x00, 0xFE, 0x00, 0x00, // '|'
+		0x00, 0x82, 0x7C, 0x10, 0x00, // '}'
+		0x00, 0x08, 0x10, 0x08, 0x10, // '~'
+};
+
+const uint8_t Font12_Columns[] =
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '!'
+		0x00, 0x00, 0x70, 0x00, 0x40, 0x00, 0x00, 0x00, 0x70, 0x00, 0x40, 0x00, 0x00, 0x00, // '"'
+		0x00, 0x00, 0x0A, 0xC0, 0x1F, 0x00, 0x6A, 0xC0, 0x1F, 0x00, 0x6A, 0x00, 0x00, 0x00, // '#'
+		0x00, 0x00, 0x1B, 0x00, 0x25, 0x00, 0x65, 0xC0, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, // '$'
+		0x00, 0x00, 0x24, 0x00, 0x54, 0x00, 0x25, 0x00, 0x0A, 0x80, 0x09, 0x00, 0x00, 0x00, // '%'
+		0x00, 0x00, 0x03, 0x00, 0x0C, 0x80, 0x12, 0x80, 0x11, 0x00, 0x02, 0x80, 0x00, 0x00, // '&'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '''
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, // '('
+		0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ')'
+		0x00, 0x00, 0x20, 0x00, 0x2C, 0x00, 0x70, 0x00, 0x2C, 0x00, 0x20, 0x00, 0x00, 0x00, // '*'
+		0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x3F, 0x80, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, // '+'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // ','
+		0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, // '-'
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '.'
+		0x00, 0x00, 0x00, 0x40, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x00, // '/'
+		0x00, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x3F, 0x00, 0x00, 0x00, // '0'
+		0x00, 0x00, 0x00, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, // '1'
+		0x00, 0x00, 0x21, 0x80, 0x42, 0x80, 0x44, 0x80, 0x48, 0x80, 0x31, 0x80, 0x00, 0x00, // '2'
+		0x00, 0x00, 0x21, 0x00, 0x40, 0x80, 0x48, 0x80, 0x48, 0x80, 0x37, 0x00, 0x00, 0x00, // '3'
+		0x00, 0x00, 0x06, 0x00, 0x0A, 0x00, 0x32, 0x00, 0x42, 0x80, 0x7F, 0x80, 0x02, 0x80, // '4'
+		0x00, 0x00, 0x01, 0x00, 0x78, 0x80, 0x48, 0x80, 0x48, 0x80, 0x47, 0x00, 0x00, 0x00, // '5'
+		0x00, 0x00, 0x1F, 0x00, 0x28, 0x80, 0x48, 0x80, 0x48, 0x80, 0x47, 0x00, 0x00, 0x00, // '6'
+		0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x41, 0x80, 0x4E, 0x00, 0x70, 0x00, 0x00, 0x00, // '7'
+		0x00, 0x00, 0x37, 0x00, 0x48, 0x80, 0x48, 0x80, 0x48, 0x80, 0x37, 0x00, 0x00, 0x00, // '8'
+		0x00, 0x00, 0x38, 0x80, 0x44, 0x80, 0x44, 0x80, 0x45, 0x00, 0x3E, 0x00, 0x00, 0x00, // '9'
+		0x00, 0x00, 0x00, 0x00, 0x19, 0x80, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ':'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x19, 0x80, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, // ';'
+		0x04, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x11, 0x00, 0x20, 0x80, 0x20, 0x80, 0x00, 0x00, // '<'
+		0x00, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x00, 0x00, // '='
+		0x20, 0x80, 0x20, 0x80, 0x11, 0x00, 0x0A, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x00, 0x00, // '>'
+		0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x22, 0x80, 0x24, 0x00, 0x18, 0x00, 0x00, 0x00, // '?'
+		0x00, 0x00, 0x7F, 0x80, 0x80, 0x40, 0x8C, 0x40, 0x92, 0x40, 0x7E, 0x80, 0x00, 0x00, // '@'
+		0x00, 0x80, 0x03, 0x80, 0x5E, 0x80, 0x62, 0x00, 0x1E, 0x80, 0x03, 0x80, 0x00, 0x80, // 'A'
+		0x40, 0x80, 0x7F, 0x80, 0x48, 0x80, 0x48, 0x80, 0x48, 0x80, 0x37, 0x00, 0x00, 0x00, // 'B'
+		0x00, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x61, 0x00, 0x00, 0x00, // 'C'
+		0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x40, 0x80, 0x21, 0x00, 0x1E, 0x00, 0x00, 0x00, // 'D'
+		0x40, 0x80, 0x7F, 0x80, 0x48, 0x80, 0x5C, 0x80, 0x40, 0x80, 0x61, 0x80, 0x00, 0x00, // 'E'
+		0x00, 0x00, 0x40, 0x80, 0x7F, 0x80, 0x48, 0x80, 0x5C, 0x00, 0x40, 0x00, 0x60, 0x00, // 'F'
+		0x00, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x40, 0x80, 0x44, 0x80, 0x67, 0x00, 0x04, 0x00, // 'G'
+		0x40, 0x80, 0x7F, 0x80, 0x48, 0x80, 0x08, 0x00, 0x48, 0x80, 0x7F, 0x80, 0x40, 0x80, // 'H'
+		0x00, 0x00, 0x40, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x40, 0x80, 0x00, 0x00, // 'I'
+		0x00, 0x00, 0x07, 0x00, 0x40, 0x80, 0x40, 0x80, 0x7F, 0x00, 0x40, 0x00, 0x00, 0x00, // 'J'
+		0x40, 0x80, 0x7F, 0x80, 0x44, 0x80, 0x0C, 0x00, 0x52, 0x00, 0x61, 0x80, 0x40, 0x80, // 'K'
+		0x00, 0x00, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x00, 0x80, 0x03, 0x80, 0x00, 0x00, // 'L'
+		0x40, 0x80, 0x7F, 0x80, 0x70, 0x80, 0x0C, 0x00, 0x70, 0x80, 0x7F, 0x80, 0x40, 0x80, // 'M'
+		0x40, 0x80, 0x7F, 0x80, 0x70, 0x80, 0x0E, 0x00, 0x41, 0x80, 0x7F, 0x80, 0x40, 0x00, // 'N'
+		0x00, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x40, 0x80, 0x40, 0x80, 0x3F, 0x00, 0x00, 0x00, // 'O'
+		0x00, 0x00, 0x40, 0x80, 0x7F, 0x80, 0x44, 0x80, 0x44, 0x00, 0x38, 0x00, 0x00, 0x00, // 'P'
+		0x00, 0x00, 0x3F, 0x00, 0x40, 0x80, 0x40, 0xC0, 0x40, 0xC0, 0x3F, 0x40, 0x00, 0x00, // 'Q'
+		0x40, 0x80, 0x7F, 0x80, 0x44, 0x80, 0x44, 0x00, 0x46, 0x00, 0x39, 0x00, 0x00, 0x80, // 'R'
+		0x00, 0x00, 0x31, 0x80, 0x49, 0x00, 0x48, 0x80, 0x28, 0x80, 0x67, 0x00, 0x00, 0x00, // 'S'
+		0x60, 0x00, 0x40, 0x00, 0x40, 0x80, 0x7F, 0x80, 0x40, 0x80, 0x40, 0x00, 0x60, 0x00, // 'T'
+		0x40, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x00, 0x80, 0x40, 0x80, 0x7F, 0x00, 0x40, 0x00, // 'U'
+		0x40, 0x00, 0x70, 0x00, 0x4E, 0x00, 0x01, 0x80, 0x4E, 0x00, 0x70, 0x00, 0x40, 0x00, // 'V'
+		0x40, 0x00, 0x7F, 0x00, 0x40, 0x80, 0x0F, 0x00, 0x40, 0x80, 0x7F, 0x00, 0x40, 0x00, // 'W'
+		0x40, 0x80, 0x61, 0x80, 0x12, 0x00, 0x0C, 0x00, 0x12, 0x00, 0x61, 0x80, 0x40, 0x80, // 'X'
+		0x40, 0x00, 0x60, 0x00, 0x58, 0x80, 0x07, 0x80, 0x58, 0x80, 0x60, 0x00, 0x40, 0x00, // 'Y'
+		0x00, 0x00, 0x61, 0x80, 0x42, 0x80, 0x4C, 0x80, 0x50, 0x80, 0x61, 0x80, 0x00, 0x00, // 'Z'
+		0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x40, 0x20, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, // '['
+		0x00, 0x00, 0x40, 0x00, 0x38, 0x00, 0x06, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, // '\'
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x40, 0x20, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, // ']'
+		0x00, 0x00, 0x08, 0x00, 0x10, 0x00, 0x60, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, // '^'
+		0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, // '_'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, // '`'
+		0x00, 0x00, 0x0B, 0x00, 0x14, 0x80, 0x14, 0x80, 0x14, 0x80, 0x0F, 0x80, 0x00, 0x80, // 'a'
+		0x40, 0x80, 0x7F, 0x80, 0x08, 0x80, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00, // 'b'
+		0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x19, 0x00, 0x00, 0x00, // 'c'
+		0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x48, 0x80, 0x7F, 0x80, 0x00, 0x80, // 'd'
+		0x00, 0x00, 0x0F, 0x00, 0x14, 0x80, 0x14, 0x80, 0x14, 0x80, 0x0C, 0x80, 0x00, 0x00, // 'e'
+		0x00, 0x00, 0x10, 0x80, 0x3F, 0x80, 0x50, 0x80, 0x50, 0x80, 0x50, 0x80, 0x00, 0x00, // 'f'
+		0x00, 0x00, 0x0F, 0x00, 0x10, 0xA0, 0x10, 0xA0, 0x08, 0xA0, 0x1F, 0xC0, 0x10, 0x00, // 'g'
+		0x40, 0x80, 0x7F, 0x80, 0x08, 0x80, 0x10, 0x00, 0x10, 0x80, 0x0F, 0x80, 0x00, 0x80, // 'h'
+		0x00, 0x00, 0x10, 0x80, 0x10, 0x80, 0x5F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, // 'i'
+		0x00, 0x00, 0x10, 0x20, 0x10, 0x20, 0x50, 0x20, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, // 'j'
+		0x40, 0x80, 0x7F, 0x80, 0x04, 0x00, 0x16, 0x80, 0x19, 0x80, 0x10, 0x80, 0x00, 0x00, // 'k'
+		0x00, 0x00, 0x00, 0x80, 0x40, 0x80, 0x7F, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, // 'l'
+		0x10, 0x80, 0x1F, 0x80, 0x10, 0x80, 0x0F, 0x80, 0x10, 0x80, 0x0F, 0x80, 0x00, 0x80, // 'm'
+		0x10, 0x80, 0x1F, 0x80, 0x08, 0x80, 0x10, 0x00, 0x10, 0x80, 0x0F, 0x80, 0x00, 0x80, // 'n'
+		0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00, // 'o'
+		0x10, 0x20, 0x1F, 0xE0, 0x08, 0xA0, 0x10, 0x80, 0x10, 0x80, 0x0F, 0x00, 0x00, 0x00, // 'p'
+		0x00, 0x00, 0x0F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x08, 0xA0, 0x1F, 0xE0, 0x10, 0x20, // 'q'
+		0x00, 0x00, 0x10, 0x80, 0x1F, 0x80, 0x08, 0x80, 0x10, 0x80, 0x10, 0x80, 0x00, 0x00, // 'r'
+		0x00, 0x00, 0x09, 0x80, 0x14, 0x80, 0x14, 0x80, 0x14, 0x80, 0x1B, 0x00, 0x00, 0x00, // 's'
+		0x00, 0x00, 0x10, 0x00, 0x3F, 0x00, 0x10, 0x80, 0x10, 0x80, 0x10, 0x80, 0x01, 0x00, // 't'
+		0x10, 0x00, 0x1F, 0x00, 0x00, 0x80, 0x00, 0x80, 0x11, 0x00, 0x1F, 0x80, 0x00, 0x80, // 'u'
+		0x10, 0x00, 0x1C, 0x00, 0x13, 0x00, 0x00, 0x80, 0x13, 0x00, 0x1C, 0x00, 0x10, 0x00, // 'v'
+		0x10, 0x00, 0x1F, 0x00, 0x10, 0x80, 0x07, 0x00, 0x10, 0x80, 0x1F, 0x00, 0x10, 0x00, // 'w'
+		0x10, 0x80, 0x19, 0x80, 0x06, 0x00, 0x06, 0x00, 0x19, 0x80, 0x10, 0x80, 0x00, 0x00, // 'x'
+		0x10, 0x00, 0x18, 0x20, 0x16, 0x20, 0x01, 0xE0, 0x13, 0x20, 0x1C, 0x00, 0x10, 0x00, // 'y'
+		0x00, 0x00, 0x19, 0x80, 0x12, 0x80, 0x14, 0x80, 0x18, 0x80, 0x11, 0x80, 0x00, 0x00, // 'z'
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3D, 0xC0, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, // '{'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '|'
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0x3D, 0xC0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // '}'
+		0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x00, // '~'
+};
+
+const uint8_t Font16_Columns[] =
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xA0, 0x7F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '!'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x00, 0x00, // '"'
+		0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0xF0, 0x7F, 0xF0, 0x7D, 0x00, 0x07, 0xF0, 0x7F, 0xF0, 0x7D, 0x00, 0x05, 0x00, 0x00, 0x00, // '#'
+		0x00, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x7C, 0xE0, 0x4E, 0x20, 0xC6, 0x38, 0x47, 0x20, 0x73, 0xE0, 0x71, 0xC0, 0x00, 0x00, 0x00, 0x00, // '$'
+		0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x4B, 0x00, 0x4A, 0x00, 0x36, 0x00, 0x06, 0xC0, 0x05, 0x20, 0x0D, 0x20, 0x08, 0xC0, 0x00, 0x00, // '%'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1D, 0xE0, 0x3F, 0x20, 0x23, 0xA0, 0x20, 0xC0, 0x21, 0xE0, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00, // '&'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '''
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x1F, 0xE0, 0x78, 0x78, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '('
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x70, 0x38, 0x1F, 0xF0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ')'
+		0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x1F, 0x00, 0x1B, 0x00, 0x18, 0x00, 0x00, 0x00, // '*'
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x1F, 0xC0, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // '+'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ','
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // '-'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '.'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x78, 0x01, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x00, 0x00, 0x00, // '/'
+		0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xC0, 0x60, 0x60, 0x40, 0x20, 0x60, 0x60, 0x3F, 0xC0, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, // '0'
+		0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, // '1'
+		0x00, 0x00, 0x00, 0x00, 0x18, 0x60, 0x38, 0xE0, 0x61, 0xA0, 0x43, 0x20, 0x46, 0x20, 0x7C, 0x20, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, // '2'
+		0x00, 0x00, 0x20, 0x40, 0x60, 0x60, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x4E, 0x20, 0x7F, 0xE0, 0x33, 0xC0, 0x00, 0x00, 0x00, 0x00, // '3'
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x07, 0x80, 0x1C, 0xA0, 0x70, 0xA0, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, // '4'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x7E, 0x20, 0x7C, 0x20, 0x44, 0x20, 0x44, 0x20, 0x47, 0xE0, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, // '5'
+		0x00, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x3F, 0xC0, 0x32, 0x60, 0x64, 0x20, 0x44, 0x20, 0x47, 0xE0, 0x43, 0xC0, 0x00, 0x00, 0x00, 0x00, // '6'
+		0x00, 0x00, 0x60, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0xE0, 0x4F, 0xE0, 0x7F, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '7'
+		0x00, 0x00, 0x00, 0x00, 0x3B, 0xC0, 0x7F, 0xE0, 0x44, 0x20, 0x44, 0x20, 0x44, 0x20, 0x7F, 0xE0, 0x3B, 0xC0, 0x00, 0x00, 0x00, 0x00, // '8'
+		0x00, 0x00, 0x00, 0x00, 0x3C, 0x20, 0x7E, 0x20, 0x42, 0x20, 0x42, 0x60, 0x64, 0xC0, 0x3F, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, // '9'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ':'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x60, 0x0C, 0x40, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ';'
+		0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x05, 0x00, 0x05, 0x00, 0x08, 0x80, 0x10, 0x40, 0x10, 0x40, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, // '<'
+		0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, // '='
+		0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x10, 0x40, 0x10, 0x40, 0x08, 0x80, 0x05, 0x00, 0x05, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, // '>'
+		0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x38, 0x00, 0x21, 0xA0, 0x23, 0xA0, 0x22, 0x00, 0x3E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, // '?'
+		0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x20, 0x20, 0x43, 0x10, 0x44, 0x90, 0x44, 0x90, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '@'
+		0x00, 0x00, 0x00, 0x20, 0x20, 0xE0, 0x27, 0xE0, 0x3F, 0x20, 0x31, 0x00, 0x31, 0x00, 0x3F, 0x20, 0x07, 0xE0, 0x00, 0xE0, 0x00, 0x20, // 'A'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x22, 0x20, 0x3F, 0xE0, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, // 'B'
+		0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x40, 0x38, 0x80, 0x00, 0x00, // 'C'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x60, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, // 'D'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x27, 0x20, 0x20, 0x20, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, // 'E'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x27, 0x00, 0x20, 0x00, 0x20, 0x00, 0x38, 0x00, 0x00, 0x00, // 'F'
+		0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x60, 0x20, 0x20, 0x21, 0x20, 0x21, 0x20, 0x11, 0xE0, 0x39, 0xC0, 0x01, 0x00, 0x00, 0x00, // 'G'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x02, 0x00, 0x22, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x00, 0x00, // 'H'
+		0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, // 'I'
+		0x00, 0x00, 0x01, 0xC0, 0x01, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xC0, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00, // 'J'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x23, 0x20, 0x07, 0x00, 0x2D, 0x80, 0x38, 0xE0, 0x30, 0x60, 0x20, 0x20, 0x00, 0x00, // 'K'
+		0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00, 0x20, 0x01, 0xE0, 0x00, 0x00, // 'L'
+		0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x0C, 0x20, 0x07, 0x20, 0x01, 0x80, 0x07, 0x20, 0x0C, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, // 'M'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x0C, 0x20, 0x07, 0x00, 0x21, 0x80, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x00, 0x00, 0x00, // 'N'
+		0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x60, 0x1F, 0xC0, 0x0F, 0x80, 0x00, 0x00, // 'O'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x21, 0x20, 0x21, 0x20, 0x21, 0x20, 0x3F, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, // 'P'
+		0x00, 0x00, 0x0F, 0x80, 0x1F, 0xC0, 0x30, 0x68, 0x20, 0x38, 0x20, 0x38, 0x20, 0x28, 0x30, 0x68, 0x1F, 0xD8, 0x0F, 0x90, 0x00, 0x00, // 'Q'
+		0x00, 0x00, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x22, 0x20, 0x22, 0x20, 0x23, 0x00, 0x3D, 0xC0, 0x1C, 0xE0, 0x00, 0x20, 0x00, 0x20, // 'R'
+		0x00, 0x00, 0x00, 0x00, 0x1C, 0xE0, 0x3E, 0xE0, 0x26, 0x20, 0x22, 0x20, 0x23, 0x20, 0x3B, 0xE0, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, // 'S'
+		0x00, 0x00, 0x3C, 0x00, 0x20, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xE0, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, // 'T'
+		0x00, 0x00, 0x20, 0x00, 0x3F, 0xC0, 0x3F, 0xE0, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x3F, 0xE0, 0x3F, 0xC0, 0x20, 0x00, 0x00, 0x00, // 'U'
+		0x00, 0x00, 0x20, 0x00, 0x38, 0x00, 0x3F, 0x00, 0x27, 0xE0, 0x00, 0x60, 0x27, 0xE0, 0x3F, 0x00, 0x38, 0x00, 0x20, 0x00, 0x00, 0x00, // 'V'
+		0x20, 0x00, 0x3E, 0x00, 0x3F, 0xE0, 0x20, 0xE0, 0x27, 0xC0, 0x0E, 0x00, 0x27, 0xC0, 0x20, 0xE0, 0x3F, 0xE0, 0x3E, 0x00, 0x20, 0x00, // 'W'
+		0x00, 0x00, 0x20, 0x20, 0x30, 0x60, 0x38, 0xE0, 0x2F, 0xA0, 0x07, 0x00, 0x2F, 0xA0, 0x38, 0xE0, 0x30, 0x60, 0x20, 0x20, 0x00, 0x00, // 'X'
+		0x00, 0x00, 0x20, 0x00, 0x30, 0x00, 0x38, 0x20, 0x2C, 0x20, 0x07, 0xE0, 0x07, 0xE0, 0x2C, 0x20, 0x38, 0x20, 0x30, 0x00, 0x20, 0x00, // 'Y'
+		0x00, 0x00, 0x00, 0x00, 0x38, 0x60, 0x20, 0xE0, 0x21, 0xA0, 0x27, 0x20, 0x2C, 0x20, 0x38, 0x20, 0x30, 0xE0, 0x00, 0x00, 0x00, 0x00, // 'Z'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x40, 0x08, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, // '['
+		0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x18, 0x00, 0x00, // '\'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x40, 0x08, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ']'
+		0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x10, 0x00, 0x60, 0x00, 0x80, 0x00, 0x60, 0x00, 0x10, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, // '^'
+		0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, // '_'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x40, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '`'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x09, 0xE0, 0x09, 0x20, 0x09, 0x20, 0x09, 0x40, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x20, 0x00, 0x00, // 'a'
+		0x00, 0x00, 0x40, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x04, 0x40, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, // 'b'
+		0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x04, 0x60, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00, // 'c'
+		0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x44, 0x40, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x00, // 'd'
+		0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0D, 0x60, 0x09, 0x20, 0x09, 0x20, 0x09, 0x20, 0x0D, 0x20, 0x07, 0x60, 0x03, 0x40, 0x00, 0x00, // 'e'
+		0x00, 0x00, 0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x3F, 0xE0, 0x7F, 0xE0, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x40, 0x00, 0x40, 0x00, // 'f'
+		0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x64, 0x08, 0x24, 0x08, 0x24, 0x04, 0x44, 0x0F, 0xFC, 0x0F, 0xF8, 0x08, 0x00, 0x00, 0x00, // 'g'
+		0x00, 0x00, 0x40, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x04, 0x20, 0x08, 0x00, 0x08, 0x20, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x20, 0x00, 0x00, // 'h'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x20, 0x08, 0x20, 0x6F, 0xE0, 0x6F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, // 'i'
+		0x00, 0x00, 0x00, 0x00, 0x08, 0x04, 0x08, 0x04, 0x08, 0x04, 0x68, 0x04, 0x6F, 0xFC, 0x0F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'j'
+		0x00, 0x00, 0x40, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x03, 0x00, 0x0F, 0xA0, 0x0C, 0xE0, 0x08, 0x60, 0x08, 0x20, 0x00, 0x20, 0x00, 0x00, // 'k'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x20, 0x40, 0x20, 0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, // 'l'
+		0x00, 0x00, 0x08, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x08, 0x00, 0x0F, 0xE0, 0x0F, 0xE0, 0x08, 0x00, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x20, // 'm'
+		0x00, 0x00, 0x08, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x04, 0x20, 0x08, 0x00, 0x08, 0x20, 0x0F, 0xE0, 0x07, 0xE0, 0x00, 0x20, 0x00, 0x00, // 'n'
+		0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, // 'o'
+		0x00, 0x00, 0x08, 0x04, 0x0F, 0xFC, 0x0F, 0xFC, 0x04, 0x44, 0x08, 0x24, 0x08, 0x20, 0x0C, 0x60, 0x07, 0xC0, 0x03, 0x80, 0x00, 0x00, // 'p'
+		0x00, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x24, 0x04, 0x44, 0x0F, 0xFC, 0x0F, 0xFC, 0x08, 0x04, 0x00, 0x00, // 'q'
+		0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x0F, 0xE0, 0x0F, 0xE0, 0x04, 0x20, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x00, 0x04, 0x00, 0x00, 0x00, // 'r'
+		0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x0F, 0x60, 0x0B, 0x20, 0x0B, 0x20, 0x09, 0xA0, 0x0D, 0xE0, 0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, // 's'
+		0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x7F, 0xC0, 0x7F, 0xE0, 0x08, 0x20, 0x08, 0x20, 0x08, 0x20, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, // 't'
+		0x00, 0x00, 0x08, 0x00, 0x0F, 0xC0, 0x0F, 0xE0, 0x00, 0x20, 0x00, 0x20, 0x08, 0x40, 0x0F, 0xE0, 0x0F, 0xE0, 0x00, 0x20, 0x00, 0x00, // 'u'
+		0x00, 0x00, 0x08, 0x00, 0x0E, 0x00, 0x0F, 0x80, 0x09, 0xE0, 0x00, 0x60, 0x09, 0xE0, 0x0F, 0x80, 0x0E, 0x00, 0x08, 0x00, 0x00, 0x00, // 'v'
+		0x08, 0x00, 0x0F, 0x00, 0x0F, 0xE0, 0x08, 0xE0, 0x01, 0xC0, 0x03, 0x00, 0x01, 0xC0, 0x08, 0xE0, 0x0F, 0xE0, 0x0F, 0x00, 0x08, 0x00, // 'w'
+		0x00, 0x00, 0x08, 0x20, 0x08, 0x20, 0x0C, 0x60, 0x0F, 0xE0, 0x03, 0x80, 0x0F, 0xE0, 0x0C, 0x60, 0x08, 0x20, 0x08, 0x20, 0x00, 0x00, // 'x'
+		0x00, 0x00, 0x08, 0x00, 0x0C, 0x04, 0x0F, 0x04, 0x0B, 0xCC, 0x00, 0x7C, 0x00, 0xF4, 0x0B, 0xC0, 0x0F, 0x00, 0x0C, 0x00, 0x08, 0x00, // 'y'
+		0x00, 0x00, 0x00, 0x00, 0x0C, 0x60, 0x08, 0xE0, 0x09, 0xA0, 0x09, 0x20, 0x0B, 0x20, 0x0E, 0x20, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, // 'z'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3F, 0xF0, 0x7E, 0xF8, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '{'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '|'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x08, 0x7E, 0xF8, 0x3F, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '}'
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // '~'
+};
+
+const uint8_t Font20_Columns[] =
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0C, 0x00, 0x7F, 0xCC, 0x00, 0x7F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '!'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '"'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '#'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x78, 0x00, 0x1F, 0x78, 0x00, 0x33, 0x18, 0x00, 0xF3, 0x1F, 0x00, 0xF3, 0x1F, 0x00, 0x31, 0x98, 0x00, 0x39, 0xF0, 0x00, 0x38, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '$'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC0, 0x00, 0x44, 0xC0, 0x00, 0x45, 0x80, 0x00, 0x45, 0x80, 0x00, 0x39, 0x38, 0x00, 0x03, 0x44, 0x00, 0x03, 0x44, 0x00, 0x06, 0x44, 0x00, 0x06, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '%'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x0E, 0xF8, 0x00, 0x0F, 0xCC, 0x00, 0x19, 0xCC, 0x00, 0x18, 0xEC, 0x00, 0x18, 0x7C, 0x00, 0x18, 0x78, 0x00, 0x18, 0xEC, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '&'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '''
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x7C, 0x0F, 0x80, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '('
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x7C, 0x0F, 0x80, 0x1F, 0xFE, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ')'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '*'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '+'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ','
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '-'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '.'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '/'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0xF8, 0x00, 0x70, 0x1C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x70, 0x1C, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '0'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '1'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x70, 0x3C, 0x00, 0x60, 0x6C, 0x00, 0x60, 0xCC, 0x00, 0x61, 0x8C, 0x00, 0x73, 0x0C, 0x00, 0x3E, 0x0C, 0x00, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '2'
+		0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x30, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x77, 0x9C, 0x00, 0x3F, 0xF8, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '3'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x60, 0x00, 0x0E, 0x60, 0x00, 0x38, 0x6C, 0x00, 0x70, 0x6C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '4'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7F, 0x1C, 0x00, 0x7F, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x67, 0x1C, 0x00, 0x63, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '5'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x3D, 0x98, 0x00, 0x33, 0x0C, 0x00, 0x73, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x9C, 0x00, 0x61, 0xF8, 0x00, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '6'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x1C, 0x00, 0x60, 0xFC, 0x00, 0x67, 0xE0, 0x00, 0x7F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '7'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x77, 0x9C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x63, 0x0C, 0x00, 0x77, 0x9C, 0x00, 0x3F, 0xF8, 0x00, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '8'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x0C, 0x00, 0x3F, 0x0C, 0x00, 0x73, 0x8C, 0x00, 0x61, 0x8C, 0x00, 0x61, 0x9C, 0x00, 0x61, 0x98, 0x00, 0x33, 0x78, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '9'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ':'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1E, 0x00, 0x07, 0x18, 0x00, 0x07, 0x10, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ';'
+		0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x60, 0x00, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x18, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '<'
+		0x00, 0x00, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '='
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0C, 0x00, 0x18, 0x0C, 0x00, 0x0C, 0x18, 0x00, 0x0C, 0x18, 0x00, 0x06, 0x30, 0x00, 0x06, 0x30, 0x00, 0x03, 0x60, 0x00, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, // '>'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30, 0xCC, 0x00, 0x31, 0xCC, 0x00, 0x31, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '?'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x30, 0x0C, 0x00, 0x20, 0x02, 0x00, 0x41, 0xC2, 0x00, 0x42, 0x22, 0x00, 0x62, 0x22, 0x00, 0x1F, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '@'
+		0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1C, 0x00, 0x30, 0x7C, 0x00, 0x31, 0xEC, 0x00, 0x37, 0xE0, 0x00, 0x3E, 0x60, 0x00, 0x38, 0x60, 0x00, 0x3F, 0x60, 0x00, 0x07, 0xEC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, // 'A'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x33, 0x8C, 0x00, 0x1F, 0xCC, 0x00, 0x0E, 0xFC, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'B'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1C, 0x38, 0x00, 0x38, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x18, 0x1C, 0x00, 0x3C, 0x38, 0x00, 0x3C, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'C'
+		0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'D'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x33, 0xCC, 0x00, 0x33, 0xCC, 0x00, 0x30, 0x0C, 0x00, 0x3C, 0x3C, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'E'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x33, 0xCC, 0x00, 0x33, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'F'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0x18, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0xCC, 0x00, 0x30, 0xCC, 0x00, 0x18, 0xCC, 0x00, 0x3C, 0xF8, 0x00, 0x3C, 0xF8, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, // 'G'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x31, 0x8C, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x31, 0x8C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'H'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'I'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x1C, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // 'J'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x31, 0x8C, 0x00, 0x33, 0x0C, 0x00, 0x07, 0x80, 0x00, 0x3C, 0xE0, 0x00, 0x38, 0x78, 0x00, 0x38, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, // 'K'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'L'
+		0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3C, 0x0C, 0x00, 0x07, 0x8C, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x07, 0x8C, 0x00, 0x3C, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, // 'M'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x1E, 0x0C, 0x00, 0x07, 0x8C, 0x00, 0x31, 0xE0, 0x00, 0x30, 0x78, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'N'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1C, 0x38, 0x00, 0x38, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'O'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0xCC, 0x00, 0x30, 0xCC, 0x00, 0x30, 0xCC, 0x00, 0x30, 0xC0, 0x00, 0x39, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'P'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xF0, 0x00, 0x1C, 0x39, 0x80, 0x38, 0x1F, 0x80, 0x30, 0x0F, 0x00, 0x30, 0x0F, 0x00, 0x38, 0x1F, 0x80, 0x1C, 0x39, 0x80, 0x0F, 0xF3, 0x80, 0x07, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'Q'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x80, 0x00, 0x31, 0xC0, 0x00, 0x3B, 0xF0, 0x00, 0x1F, 0x78, 0x00, 0x0E, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, // 'R'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x3C, 0x00, 0x1F, 0x3C, 0x00, 0x3B, 0x18, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x31, 0x8C, 0x00, 0x18, 0xDC, 0x00, 0x3C, 0xF8, 0x00, 0x3C, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'S'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'T'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x3F, 0xF8, 0x00, 0x30, 0x1C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x30, 0x1C, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xF0, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'U'
+		0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x33, 0xE0, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x33, 0xE0, 0x00, 0x3F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'V'
+		0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x3F, 0xFC, 0x00, 0x30, 0x3C, 0x00, 0x30, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x30, 0xF8, 0x00, 0x30, 0x3C, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0x80, 0x00, 0x30, 0x00, 0x00, // 'W'
+		0x00, 0x00, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x3C, 0x3C, 0x00, 0x36, 0x6C, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x03, 0xC0, 0x00, 0x36, 0x6C, 0x00, 0x3C, 0x3C, 0x00, 0x38, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'X'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x3C, 0x0C, 0x00, 0x37, 0x0C, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x37, 0x0C, 0x00, 0x3C, 0x0C, 0x00, 0x38, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'Y'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1C, 0x00, 0x3C, 0x3C, 0x00, 0x30, 0x6C, 0x00, 0x31, 0xCC, 0x00, 0x33, 0x8C, 0x00, 0x36, 0x0C, 0x00, 0x3C, 0x3C, 0x00, 0x38, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'Z'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '['
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '\'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ']'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '^'
+		0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, // '_'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '`'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x02, 0x7C, 0x00, 0x06, 0xEC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xD8, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'a'
+		0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0x18, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'b'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x1C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x02, 0x0C, 0x00, 0x07, 0x98, 0x00, 0x07, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'c'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x18, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x63, 0x18, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, // 'd'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xD8, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x03, 0xCC, 0x00, 0x03, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'e'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x66, 0x0C, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'f'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x18, 0xC0, 0x06, 0x0C, 0xC0, 0x06, 0x0C, 0xC0, 0x06, 0x0C, 0xC0, 0x06, 0x0C, 0xC0, 0x03, 0x19, 0xC0, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, // 'g'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0x0C, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'h'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x67, 0xFC, 0x00, 0x67, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'i'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x66, 0x00, 0xC0, 0x66, 0x01, 0xC0, 0x07, 0xFF, 0x80, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'j'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x3C, 0x00, 0x06, 0x1C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'k'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x7F, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'l'
+		0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, // 'm'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x03, 0x0C, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'n'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x18, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'o'
+		0x00, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x03, 0x18, 0xC0, 0x06, 0x0C, 0xC0, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x03, 0x18, 0x00, 0x03, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'p'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0x18, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0xC0, 0x03, 0x18, 0xC0, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00, // 'q'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x01, 0x8C, 0x00, 0x03, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x07, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'r'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9C, 0x00, 0x03, 0xDC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0xCC, 0x00, 0x06, 0x6C, 0x00, 0x06, 0x6C, 0x00, 0x07, 0x78, 0x00, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 's'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0x3F, 0xFC, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 't'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x06, 0x18, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'u'
+		0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x3C, 0x00, 0x06, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'v'
+		0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFC, 0x00, 0x06, 0x3C, 0x00, 0x00, 0x70, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x70, 0x00, 0x06, 0x7C, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'w'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x07, 0x1C, 0x00, 0x07, 0xBC, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x07, 0xBC, 0x00, 0x07, 0x1C, 0x00, 0x06, 0x0C, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'x'
+		0x00, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x07, 0x00, 0xC0, 0x07, 0xC0, 0xC0, 0x06, 0xF1, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1E, 0xC0, 0x00, 0x38, 0xC0, 0x06, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'y'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0C, 0x00, 0x07, 0x1C, 0x00, 0x06, 0x3C, 0x00, 0x06, 0x6C, 0x00, 0x06, 0xCC, 0x00, 0x07, 0x8C, 0x00, 0x07, 0x1C, 0x00, 0x06, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'z'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE0, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xBF, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '{'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '|'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x7F, 0xBF, 0x80, 0x3F, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '}'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '~'
+};
+
+const uint8_t Font24_Columns[] =
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE1, 0x80, 0x3F, 0xF9, 0x80, 0x3F, 0xE1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '!'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '"'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0xBF, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0xD8, 0x00, 0x01, 0x98, 0x00, 0x01, 0xBF, 0xC0, 0x3F, 0xFF, 0xC0, 0x3F, 0xD8, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '#'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1F, 0x00, 0x0F, 0x9F, 0x00, 0x19, 0xCE, 0x00, 0x18, 0xC3, 0x00, 0x78, 0xC3, 0xF0, 0x78, 0xE3, 0xF0, 0x0E, 0x67, 0x00, 0x1E, 0x7E, 0x00, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '$'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x20, 0x00, 0x1F, 0xA0, 0x00, 0x39, 0xFE, 0x00, 0x30, 0xFF, 0x00, 0x30, 0xF3, 0x80, 0x39, 0xE1, 0x80, 0x1F, 0xE1, 0x80, 0x0F, 0xF3, 0x80, 0x00, 0xBF, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '%'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x03, 0x9F, 0x00, 0x07, 0xF9, 0x80, 0x0C, 0x71, 0x80, 0x0C, 0x39, 0x80, 0x0C, 0x1D, 0x80, 0x0E, 0x0F, 0x80, 0x0E, 0x0F, 0x00, 0x0C, 0x1F, 0x80, 0x00, 0x19, 0x80, 0x00, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '&'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0xC0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '''
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x0F, 0xFF, 0xC0, 0x1F, 0x03, 0xE0, 0x3C, 0x00, 0xF0, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '('
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x3C, 0x00, 0xF0, 0x1F, 0x03, 0xE0, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ')'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0x30, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '*'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '+'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ','
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '-'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '.'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '/'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x1C, 0x07, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x1C, 0x07, 0x00, 0x0F, 0xFE, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '0'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x1C, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '1'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x01, 0x80, 0x1E, 0x03, 0x80, 0x18, 0x07, 0x80, 0x30, 0x0D, 0x80, 0x30, 0x19, 0x80, 0x30, 0x31, 0x80, 0x30, 0x31, 0x80, 0x30, 0x61, 0x80, 0x18, 0xC1, 0x80, 0x1F, 0x81, 0x80, 0x07, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '2'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x18, 0x03, 0x80, 0x18, 0x01, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x39, 0xE1, 0x80, 0x1F, 0x63, 0x00, 0x0E, 0x3F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '3'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xEC, 0x00, 0x03, 0xCC, 0x00, 0x07, 0x0D, 0x80, 0x1C, 0x0D, 0x80, 0x38, 0x0D, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x0D, 0x80, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '4'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x3F, 0xC3, 0x00, 0x3F, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x31, 0x81, 0x80, 0x30, 0xC3, 0x00, 0x30, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '5'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFF, 0x00, 0x0E, 0x63, 0x00, 0x1C, 0xC1, 0x80, 0x18, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0x63, 0x80, 0x30, 0x7F, 0x00, 0x30, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '6'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x03, 0x80, 0x30, 0x1F, 0x80, 0x30, 0xFE, 0x00, 0x37, 0xF0, 0x00, 0x3F, 0x80, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '7'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1E, 0x00, 0x1F, 0x3F, 0x00, 0x39, 0xE3, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x30, 0xC1, 0x80, 0x39, 0xE3, 0x80, 0x1F, 0x3F, 0x00, 0x0E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '8'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x01, 0x80, 0x1F, 0xC1, 0x80, 0x38, 0xC1, 0x80, 0x30, 0x61, 0x80, 0x30, 0x61, 0x80, 0x30, 0x63, 0x00, 0x30, 0x67, 0x00, 0x18, 0xCE, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '9'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ':'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x03, 0xC0, 0x03, 0x87, 0x80, 0x03, 0x86, 0x00, 0x03, 0x84, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ';'
+		0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x8C, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x06, 0x03, 0x00, 0x0E, 0x03, 0x80, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '<'
+		0x00, 0x00, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x01, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '='
+		0x00, 0x00, 0x00, 0x0C, 0x01, 0x80, 0x0C, 0x01, 0x80, 0x0E, 0x03, 0x80, 0x06, 0x03, 0x00, 0x03, 0x06, 0x00, 0x03, 0x06, 0x00, 0x01, 0x8C, 0x00, 0x01, 0x8C, 0x00, 0x00, 0xD8, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '>'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x39, 0x80, 0x18, 0x39, 0x80, 0x18, 0x70, 0x00, 0x1C, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '?'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xFF, 0x80, 0x1C, 0x01, 0xC0, 0x38, 0x00, 0xE0, 0x30, 0xF0, 0x60, 0x31, 0xF8, 0x60, 0x33, 0x8C, 0x60, 0x3B, 0x0C, 0x60, 0x1F, 0xFC, 0xC0, 0x0F, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '@'
+		0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x18, 0x0F, 0x80, 0x18, 0x3D, 0x80, 0x18, 0xF9, 0x80, 0x1B, 0xD8, 0x00, 0x1F, 0x18, 0x00, 0x1C, 0x18, 0x00, 0x0F, 0x19, 0x80, 0x03, 0xF9, 0x80, 0x00, 0xF9, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x07, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, // 'A'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x1C, 0xE1, 0x80, 0x0F, 0xF1, 0x80, 0x07, 0xBF, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'B'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0E, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x03, 0x80, 0x1F, 0x07, 0x00, 0x1F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'C'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x03, 0x80, 0x0E, 0x07, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'D'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0x0F, 0x80, 0x1F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'E'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x19, 0xF9, 0x80, 0x19, 0xF9, 0x80, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'F'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x07, 0xFE, 0x00, 0x0E, 0x07, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x0C, 0x33, 0x80, 0x1F, 0x3F, 0x00, 0x1F, 0x3F, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'G'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'H'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'I'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'J'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x31, 0x80, 0x18, 0x61, 0x80, 0x18, 0xE1, 0x80, 0x01, 0xF0, 0x00, 0x03, 0x38, 0x00, 0x1E, 0x1E, 0x00, 0x1C, 0x0F, 0x80, 0x18, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, // 'K'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'L'
+		0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x0F, 0x01, 0x80, 0x03, 0xC1, 0x80, 0x00, 0xF1, 0x80, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF1, 0x80, 0x03, 0xC1, 0x80, 0x0F, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, // 'M'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x07, 0x01, 0x80, 0x03, 0xC1, 0x80, 0x01, 0xE1, 0x80, 0x18, 0x78, 0x00, 0x18, 0x3C, 0x00, 0x18, 0x0E, 0x00, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'N'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0x0F, 0x00, 0x0C, 0x03, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x0C, 0x03, 0x00, 0x0F, 0x0F, 0x00, 0x07, 0xFE, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'O'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x31, 0x80, 0x18, 0x30, 0x00, 0x1C, 0x60, 0x00, 0x0F, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'P'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xFE, 0x00, 0x0F, 0x0F, 0x30, 0x0C, 0x03, 0xF0, 0x18, 0x01, 0xE0, 0x18, 0x01, 0xE0, 0x18, 0x01, 0xE0, 0x18, 0x01, 0xE0, 0x0C, 0x03, 0x30, 0x0F, 0x0F, 0x30, 0x07, 0xFE, 0x70, 0x01, 0xF8, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'Q'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x70, 0x00, 0x18, 0x78, 0x00, 0x1C, 0xDE, 0x00, 0x0F, 0xCF, 0x00, 0x07, 0x83, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'R'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8F, 0x80, 0x0F, 0xCF, 0x80, 0x1C, 0xC3, 0x00, 0x18, 0xE1, 0x80, 0x18, 0x61, 0x80, 0x18, 0x61, 0x80, 0x18, 0x71, 0x80, 0x0C, 0x33, 0x80, 0x1F, 0x3F, 0x00, 0x1F, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'S'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1F, 0x80, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'T'
+		0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x18, 0x03, 0x00, 0x18, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFC, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'U'
+		0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x1B, 0xE0, 0x00, 0x18, 0x7C, 0x00, 0x18, 0x1F, 0x00, 0x00, 0x03, 0x80, 0x18, 0x1F, 0x00, 0x18, 0x7C, 0x00, 0x1B, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, // 'V'
+		0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x18, 0xFF, 0x80, 0x18, 0x0F, 0x80, 0x18, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x18, 0x3E, 0x00, 0x18, 0x0F, 0x80, 0x18, 0xFF, 0x80, 0x1F, 0xF8, 0x00, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, // 'W'
+		0x00, 0x00, 0x00, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1C, 0x03, 0x80, 0x1E, 0x07, 0x80, 0x1B, 0x0D, 0x80, 0x19, 0x99, 0x80, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x19, 0x99, 0x80, 0x1B, 0x0D, 0x80, 0x1E, 0x07, 0x80, 0x1C, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'X'
+		0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1E, 0x01, 0x80, 0x1B, 0x81, 0x80, 0x01, 0xC1, 0x80, 0x00, 0x7F, 0x80, 0x00, 0x7F, 0x80, 0x19, 0xC1, 0x80, 0x1B, 0x81, 0x80, 0x1E, 0x01, 0x80, 0x1C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'Y'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x1F, 0x87, 0x80, 0x1F, 0x8D, 0x80, 0x18, 0x19, 0x80, 0x18, 0x31, 0x80, 0x18, 0x61, 0x80, 0x18, 0xC1, 0x80, 0x19, 0x81, 0x80, 0x1B, 0x01, 0x80, 0x1E, 0x1F, 0x80, 0x1C, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'Z'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '['
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '\'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ']'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00, 0x03, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '^'
+		0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, // '_'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x30, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '`'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x01, 0x1F, 0x00, 0x03, 0x19, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x33, 0x00, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'a'
+		0x00, 0x00, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'b'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xC7, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x80, 0x03, 0xE7, 0x00, 0x03, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'c'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x33, 0x01, 0x80, 0x31, 0x83, 0x00, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'd'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xB3, 0x00, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x01, 0xB1, 0x80, 0x01, 0xF3, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'e'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x0F, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x01, 0x80, 0x33, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'f'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x83, 0x0C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x01, 0x83, 0x18, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'g'
+		0x00, 0x00, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x01, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x81, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'h'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x33, 0xFF, 0x80, 0x33, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'i'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x33, 0x00, 0x0C, 0x33, 0x00, 0x18, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'j'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x38, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xEE, 0x00, 0x03, 0x87, 0x80, 0x03, 0x03, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'k'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x3F, 0xFF, 0x80, 0x3F, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'l'
+		0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x03, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0xFF, 0x80, 0x01, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, // 'm'
+		0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x01, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x81, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'n'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xC7, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 0xC7, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'o'
+		0x00, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x01, 0x83, 0x0C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x01, 0x83, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'p'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xFF, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x8C, 0x03, 0x01, 0x8C, 0x01, 0x83, 0x0C, 0x03, 0xFF, 0xFC, 0x03, 0xFF, 0xFC, 0x03, 0x00, 0x0C, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'q'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0xC1, 0x80, 0x01, 0x81, 0x80, 0x03, 0x81, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'r'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x80, 0x01, 0xF7, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x31, 0x80, 0x03, 0x39, 0x80, 0x03, 0x19, 0x80, 0x03, 0x1B, 0x80, 0x03, 0xDF, 0x00, 0x03, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 's'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFF, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 't'
+		0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x03, 0x00, 0x03, 0xFF, 0x80, 0x03, 0xFF, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'u'
+		0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0x3E, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x0F, 0x80, 0x03, 0x3E, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'v'
+		0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xFE, 0x00, 0x03, 0x1F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x03, 0x1F, 0x80, 0x03, 0xFC, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'w'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x03, 0x83, 0x80, 0x03, 0xC7, 0x80, 0x03, 0x6D, 0x80, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x03, 0x6D, 0x80, 0x03, 0xC7, 0x80, 0x03, 0x83, 0x80, 0x03, 0x01, 0x80, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'x'
+		0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0C, 0x03, 0x80, 0x0C, 0x03, 0xE0, 0x0C, 0x03, 0x78, 0x0C, 0x03, 0x1E, 0x1C, 0x00, 0x07, 0x7C, 0x00, 0x03, 0xEC, 0x00, 0x07, 0x8C, 0x00, 0x1E, 0x00, 0x03, 0x78, 0x00, 0x03, 0xE0, 0x00, 0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // 'y'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC1, 0x80, 0x03, 0xC3, 0x80, 0x03, 0x07, 0x80, 0x03, 0x0D, 0x80, 0x03, 0x19, 0x80, 0x03, 0x31, 0x80, 0x03, 0x61, 0x80, 0x03, 0xC1, 0x80, 0x03, 0x87, 0x80, 0x03, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 'z'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x38, 0x00, 0x1F, 0xFF, 0xE0, 0x3F, 0xEF, 0xF0, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '{'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '|'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x30, 0x00, 0x30, 0x3F, 0xEF, 0xF0, 0x1F, 0xFF, 0xE0, 0x00, 0x38, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '}'
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // '~'
+};
+
+#endif /* FONT_COLUMNS */
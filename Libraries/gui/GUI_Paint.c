@@ -5,8 +5,10 @@
 #include <math.h>
 
 #include "../epd/epd.h"
+#include "nrf.h" //__CLZ()
 
 PAINT Paint;
+static void Paint_SelectWriter(void);
 /******************************************************************************
 function:	Create Image
 parameter:
@@ -20,6 +22,7 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
 {
     Paint.Image = NULL;
     Paint.Image = image;
+    Paint.ImageRed = NULL;
     Width = Width ;
     Paint.WidthMemory = Width;
     Paint.HeightMemory = Height;
@@ -31,6 +34,7 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
    
     Paint.Rotate = Rotate;
     Paint.Mirror = MIRROR_NONE;
+    Paint.Layout = IMAGE_LAYOUT_ROWS;
     
     if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
         Paint.Width = Width;
@@ -39,6 +43,7 @@ void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD
         Paint.Width = Height;
         Paint.Height = Width;
     }
+    Paint_SelectWriter();
 }
 
 /******************************************************************************
@@ -51,6 +56,213 @@ void Paint_SelectImage(UBYTE *image)
     Paint.Image = image;
 }
 
+/******************************************************************************
+function:	Select the red image, it only holds the box of the red content
+parameter:
+    image   :   Pointer to the red cache, NULL for no red
+    Size    :   Size of the red cache in bytes
+    Xstart  :   Box x starting point
+    Ystart  :   Box Y starting point
+    Xend    :   Box x end point, inclusive
+    Yend    :   Box y end point, inclusive
+******************************************************************************/
+void Paint_SelectRedImage(UBYTE *image, UDOUBLE Size, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UWORD Xs, Ys, Xe, Ye;
+
+    Paint.ImageRed = NULL;
+    if(image != NULL) {
+        Paint_GetMemoryWindow(Xstart, Ystart, Xend, Yend, &Xs, &Ys, &Xe, &Ye);
+        Paint.RedXByte = Xs / 8;
+        Paint.RedWidthByte = Xe / 8 - Xs / 8 + 1;
+        Paint.RedY = Ys;
+        Paint.RedHeight = Ye - Ys + 1;
+        if((UDOUBLE)Paint.RedWidthByte * Paint.RedHeight > Size) {
+            //Debug("Red box does not fit, cut to the rows that do\r\n");
+            Paint.RedHeight = Size / Paint.RedWidthByte;
+        }
+        if(Paint.RedHeight > 0) {
+            Paint.ImageRed = image;
+            memset(image, 0x00, Paint.RedWidthByte * Paint.RedHeight);
+        }
+    }
+    //The writers without red leave the red box alone
+    Paint_SelectWriter();
+}
+
+/******************************************************************************
+function:	Set or clear a pixel of the red image
+parameter:
+    X, Y    :   Point in the image memory
+    Red     :   1 to paint it red
+return:
+    1 if the point is inside the red box
+******************************************************************************/
+static UBYTE Paint_SetRedPixel(UWORD X, UWORD Y, UBYTE Red)
+{
+    UDOUBLE Addr;
+
+    if(Paint.ImageRed == NULL || X / 8 < Paint.RedXByte || Y < Paint.RedY)
+        return 0;
+    if(X / 8 - Paint.RedXByte >= Paint.RedWidthByte || Y - Paint.RedY >= Paint.RedHeight)
+        return 0;
+
+    if(Paint.Layout == IMAGE_LAYOUT_COLUMNS)
+        Addr = (X / 8 - Paint.RedXByte) * Paint.RedHeight + (Y - Paint.RedY);
+    else
+        Addr = (X / 8 - Paint.RedXByte) + (Y - Paint.RedY) * Paint.RedWidthByte;
+    if(Red)
+        Paint.ImageRed[Addr] |= 0x80 >> (X % 8);
+    else
+        Paint.ImageRed[Addr] &= ~(0x80 >> (X % 8));
+    return 1;
+}
+
+/******************************************************************************
+function:	Pixel writers, one per orientation of the screen on the image
+            memory and per red box or none. Paint_SelectWriter() picks the
+            one for the rotation, mirroring, layout and red image, so a
+            pixel is written without looking at them. The point is inside
+            the screen.
+parameter:
+    Xpoint  :   At point X
+    Ypoint  :   At point Y
+    Color   :   Painted colors
+    Red     :   1 if there is a red box, a constant in every writer
+******************************************************************************/
+static inline void Paint_WriteRows(UWORD X, UWORD Y, UWORD Color, UBYTE Red)
+{
+    UBYTE *Data;
+
+    if(Red) {
+        if(!Paint_SetRedPixel(X, Y, Color == RED) && Color == RED)
+            Color = BLACK; //Outside the red box
+    } else if(Color == RED) {
+        Color = BLACK;
+    }
+
+    Data = &Paint.Image[X / 8 + Y * Paint.WidthByte];
+    if(Color == BLACK)
+        *Data &= ~(0x80 >> (X % 8));
+    else
+        *Data |= 0x80 >> (X % 8);
+}
+
+//Rotation and mirroring leave 8 ways to map the screen on the memory:
+//axes kept or swapped (T), memory x and y reversed or not
+#define PAINT_ROWS_WRITER(Name, X, Y)                               \
+static void Name(UWORD Xpoint, UWORD Ypoint, UWORD Color)           \
+{                                                                   \
+    Paint_WriteRows((X), (Y), Color, 1);                            \
+}                                                                   \
+static void Name##NoRed(UWORD Xpoint, UWORD Ypoint, UWORD Color)    \
+{                                                                   \
+    Paint_WriteRows((X), (Y), Color, 0);                            \
+}
+
+PAINT_ROWS_WRITER(Paint_Write,          Xpoint, Ypoint)
+PAINT_ROWS_WRITER(Paint_WriteFlipX,     Paint.WidthMemory - Xpoint - 1, Ypoint)
+PAINT_ROWS_WRITER(Paint_WriteFlipY,     Xpoint, Paint.HeightMemory - Ypoint - 1)
+PAINT_ROWS_WRITER(Paint_WriteFlipXY,    Paint.WidthMemory - Xpoint - 1, Paint.HeightMemory - Ypoint - 1)
+PAINT_ROWS_WRITER(Paint_WriteT,         Ypoint, Xpoint)
+PAINT_ROWS_WRITER(Paint_WriteTFlipX,    Paint.WidthMemory - Ypoint - 1, Xpoint)
+PAINT_ROWS_WRITER(Paint_WriteTFlipY,    Ypoint, Paint.HeightMemory - Xpoint - 1)
+PAINT_ROWS_WRITER(Paint_WriteTFlipXY,   Paint.WidthMemory - Ypoint - 1, Paint.HeightMemory - Xpoint - 1)
+
+//Screen x runs down the memory columns, no rotation
+static inline void Paint_WriteColumnsRed(UWORD Xpoint, UWORD Ypoint, UWORD Color, UBYTE Red)
+{
+    UBYTE *Data;
+
+    if(Red) {
+        if(!Paint_SetRedPixel(Ypoint, Xpoint, Color == RED) && Color == RED)
+            Color = BLACK; //Outside the red box
+    } else if(Color == RED) {
+        Color = BLACK;
+    }
+
+    Data = &Paint.Image[(Ypoint / 8) * Paint.HeightMemory + Xpoint];
+    if(Color == BLACK)
+        *Data &= ~(0x80 >> (Ypoint % 8));
+    else
+        *Data |= 0x80 >> (Ypoint % 8);
+}
+
+static void Paint_WriteColumns(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    Paint_WriteColumnsRed(Xpoint, Ypoint, Color, 1);
+}
+
+static void Paint_WriteColumnsNoRed(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    Paint_WriteColumnsRed(Xpoint, Ypoint, Color, 0);
+}
+
+static void Paint_WriteNone(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    (void)Xpoint;
+    (void)Ypoint;
+    (void)Color;
+}
+
+//Indexed by red box or none, then by axes swapped * 4 + memory axes
+//reversed, bit 0 x, bit 1 y
+static void (*const Paint_RowsWriters[2][8])(UWORD Xpoint, UWORD Ypoint, UWORD Color) = {
+    {
+        Paint_WriteNoRed, Paint_WriteFlipXNoRed, Paint_WriteFlipYNoRed, Paint_WriteFlipXYNoRed,
+        Paint_WriteTNoRed, Paint_WriteTFlipXNoRed, Paint_WriteTFlipYNoRed, Paint_WriteTFlipXYNoRed,
+    },
+    {
+        Paint_Write, Paint_WriteFlipX, Paint_WriteFlipY, Paint_WriteFlipXY,
+        Paint_WriteT, Paint_WriteTFlipX, Paint_WriteTFlipY, Paint_WriteTFlipXY,
+    },
+};
+
+static void (*Paint_WritePixel)(UWORD Xpoint, UWORD Ypoint, UWORD Color) = Paint_WriteNone;
+
+//Paint_RowsWriters index of the writer, or one of these
+#define PAINT_WRITER_COLUMNS  8
+#define PAINT_WRITER_NONE     0xFF
+static UBYTE Paint_Writer = PAINT_WRITER_NONE;
+
+/******************************************************************************
+function:	Pick the pixel writer, after the rotation, mirroring, layout or
+            red image changed
+******************************************************************************/
+static void Paint_SelectWriter(void)
+{
+    UBYTE Index;
+    UBYTE Red = (Paint.ImageRed != NULL);
+
+    if(Paint.Layout == IMAGE_LAYOUT_COLUMNS) {
+        Paint_WritePixel = Red ? Paint_WriteColumns : Paint_WriteColumnsNoRed;
+        Paint_Writer = PAINT_WRITER_COLUMNS;
+        return;
+    }
+
+    //Reversed axes of the rotation, the mirror bits reverse them again
+    switch(Paint.Rotate) {
+    case ROTATE_0:
+        Index = 0;
+        break;
+    case ROTATE_90:
+        Index = 4 | MIRROR_HORIZONTAL;
+        break;
+    case ROTATE_180:
+        Index = MIRROR_ORIGIN;
+        break;
+    case ROTATE_270:
+        Index = 4 | MIRROR_VERTICAL;
+        break;
+    default:
+        Paint_WritePixel = Paint_WriteNone;
+        Paint_Writer = PAINT_WRITER_NONE;
+        return;
+    }
+    Paint_Writer = Index ^ (Paint.Mirror & MIRROR_ORIGIN);
+    Paint_WritePixel = Paint_RowsWriters[Red][Paint_Writer];
+}
+
 /******************************************************************************
 function:	Select Image Rotate
 parameter:
@@ -61,6 +273,14 @@ void Paint_SetRotate(UWORD Rotate)
     if(Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         //Debug("Set image Rotate %d\r\n", Rotate);
         Paint.Rotate = Rotate;
+        if(Rotate == ROTATE_0 || Rotate == ROTATE_180) {
+            Paint.Width = Paint.WidthMemory;
+            Paint.Height = Paint.HeightMemory;
+        } else {
+            Paint.Width = Paint.HeightMemory;
+            Paint.Height = Paint.WidthMemory;
+        }
+        Paint_SelectWriter();
     } else {
         //Debug("rotate = 0, 90, 180, 270\r\n");
     }
@@ -77,12 +297,33 @@ void Paint_SetMirroring(UBYTE mirror)
         mirror == MIRROR_VERTICAL || mirror == MIRROR_ORIGIN) {
         //Debug("mirror image x:%s, y:%s\r\n",(mirror & 0x01)? "mirror":"none", ((mirror >> 1) & 0x01)? "mirror":"none");
         Paint.Mirror = mirror;
+        Paint_SelectWriter();
     } else {
-        //Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, \
-        //MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
+        //Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, "
+        //      "MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
     }    
 }
 
+/******************************************************************************
+function:	Select the image memory layout
+parameter:
+    layout   :   IMAGE_LAYOUT_ROWS, or IMAGE_LAYOUT_COLUMNS for a controller
+                 that writes its RAM column first. The screen is then the
+                 memory transposed (ROTATE_270 with MIRROR_VERTICAL) and
+                 pixels are set with no rotation.
+******************************************************************************/
+void Paint_SetLayout(UBYTE layout)
+{
+    Paint.Layout = layout;
+    if(layout == IMAGE_LAYOUT_COLUMNS) {
+        Paint.Rotate = ROTATE_270;
+        Paint.Mirror = MIRROR_VERTICAL;
+        Paint.Width = Paint.HeightMemory;
+        Paint.Height = Paint.WidthMemory;
+    }
+    Paint_SelectWriter();
+}
+
 /******************************************************************************
 function:	Draw Pixels
 parameter:
@@ -92,20 +333,25 @@ parameter:
 ******************************************************************************/
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
-	UWORD X, Y;
-	UDOUBLE Addr;
-	UBYTE Rdata;
-    if(Xpoint > Paint.Width || Ypoint > Paint.Height){
+    if(Xpoint >= Paint.Width || Ypoint >= Paint.Height){
         //Debug("Exceeding display boundaries\r\n");
         return;
-    }      
-    
+    }
+    Paint_WritePixel(Xpoint, Ypoint, Color);
+}
+
+/******************************************************************************
+function:	Map a screen point to the image memory
+parameter:
+    Xpoint  :   At point X
+    Ypoint  :   At point Y
+    pX, pY  :   Column and row in the image memory
+******************************************************************************/
+static void Paint_MapPoint(UWORD Xpoint, UWORD Ypoint, UWORD *pX, UWORD *pY)
+{
+    UWORD X, Y;
 
     switch(Paint.Rotate) {
-    case 0:
-        X = Xpoint;
-        Y = Ypoint;  
-        break;
     case 90:
         X = Paint.WidthMemory - Ypoint - 1;
         Y = Xpoint;
@@ -118,39 +364,163 @@ void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
         X = Ypoint;
         Y = Paint.HeightMemory - Xpoint - 1;
         break;
-		
     default:
-        return;
-    }
-    
-    switch(Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
+        X = Xpoint;
+        Y = Ypoint;
         break;
-    case MIRROR_ORIGIN:
+    }
+
+    if(Paint.Mirror & MIRROR_HORIZONTAL)
         X = Paint.WidthMemory - X - 1;
+    if(Paint.Mirror & MIRROR_VERTICAL)
         Y = Paint.HeightMemory - Y - 1;
-        break;
-    default:
-        return;
+
+    *pX = X;
+    *pY = Y;
+}
+
+/******************************************************************************
+function:	Get the window of the image memory covering a screen window
+parameter:
+    Xstart :   x starting point
+    Ystart :   Y starting point
+    Xend   :   x end point, inclusive
+    Yend   :   y end point, inclusive
+    pXstart, pYstart, pXend, pYend : the same window in the image memory
+******************************************************************************/
+void Paint_GetMemoryWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                           UWORD *pXstart, UWORD *pYstart, UWORD *pXend, UWORD *pYend)
+{
+    UWORD X0, Y0, X1, Y1;
+
+    if(Xend >= Paint.Width)
+        Xend = Paint.Width - 1;
+    if(Yend >= Paint.Height)
+        Yend = Paint.Height - 1;
+
+    Paint_MapPoint(Xstart, Ystart, &X0, &Y0);
+    Paint_MapPoint(Xend, Yend, &X1, &Y1);
+
+    *pXstart = (X0 < X1) ? X0 : X1;
+    *pXend   = (X0 < X1) ? X1 : X0;
+    *pYstart = (Y0 < Y1) ? Y0 : Y1;
+    *pYend   = (Y0 < Y1) ? Y1 : Y0;
+}
+
+/******************************************************************************
+function:	Fill a window of an image memory a byte at a time
+parameter:
+    Image   :   Image memory
+    XStride :   Bytes from one byte of a memory row to the next
+    YStride :   Bytes from one memory row to the next
+    Xstart, Ystart, Xend, Yend : Window in the image memory, inclusive
+    Value   :   0xFF to set the bits, 0x00 to clear them
+******************************************************************************/
+static void Paint_FillBits(UBYTE *Image, UWORD XStride, UWORD YStride,
+                           UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UBYTE Value)
+{
+    UBYTE FirstMask = 0xFF >> (Xstart % 8);
+    UBYTE LastMask = 0xFF << (7 - Xend % 8);
+    UWORD Xbyte, Y;
+    UBYTE Mask, *Data;
+
+    if(Xstart / 8 == Xend / 8) {
+        FirstMask &= LastMask;
+        LastMask = FirstMask;
     }
 
-    if(X > Paint.WidthMemory || Y > Paint.HeightMemory){
-        //Debug("Exceeding display boundaries\r\n");
+    if(XStride == 1) {
+        //Masked edges and whole bytes between them along every row
+        for(Y = Ystart; Y <= Yend; Y++) {
+            Data = &Image[Xstart / 8 + Y * YStride];
+            *Data = (*Data & ~FirstMask) | (Value & FirstMask);
+            if(Xend / 8 > Xstart / 8) {
+                memset(Data + 1, Value, Xend / 8 - Xstart / 8 - 1);
+                Data += Xend / 8 - Xstart / 8;
+                *Data = (*Data & ~LastMask) | (Value & LastMask);
+            }
+        }
         return;
     }
-    
-    Addr = X / 8  + Y * Paint.WidthByte;
-    Rdata = Paint.Image[Addr];
-    if(Color == BLACK)
-        Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8)) ;
+
+    //Bytes of a column are next to each other
+    for(Xbyte = Xstart / 8; Xbyte <= Xend / 8; Xbyte++) {
+        Mask = (Xbyte == Xstart / 8) ? FirstMask : (Xbyte == Xend / 8) ? LastMask : 0xFF;
+        Data = &Image[Xbyte * XStride + Ystart * YStride];
+        if(Mask == 0xFF && YStride == 1) {
+            memset(Data, Value, Yend - Ystart + 1);
+            continue;
+        }
+        for(Y = Ystart; Y <= Yend; Y++, Data += YStride)
+            *Data = (*Data & ~Mask) | (Value & Mask);
+    }
+}
+
+/******************************************************************************
+function:	Fill a screen window with a color, as Paint_SetPixel() on each
+            of its points
+parameter:
+    Xstart, Ystart, Xend, Yend : Window on the screen, inclusive
+    Color   :   Painted colors
+******************************************************************************/
+static void Paint_FillImage(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UBYTE Value)
+{
+    if(Paint.Layout == IMAGE_LAYOUT_COLUMNS)
+        Paint_FillBits(Paint.Image, Paint.HeightMemory, 1, Xstart, Ystart, Xend, Yend, Value);
+    else
+        Paint_FillBits(Paint.Image, 1, Paint.WidthByte, Xstart, Ystart, Xend, Yend, Value);
+}
+
+static void Paint_FillWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    UWORD Xs, Ys, Xe, Ye, RedXend;
+
+    if(Paint_Writer == PAINT_WRITER_NONE || Xstart > Xend || Ystart > Yend ||
+       Xstart >= Paint.Width || Ystart >= Paint.Height)
+        return;
+
+    Paint_GetMemoryWindow(Xstart, Ystart, Xend, Yend, &Xs, &Ys, &Xe, &Ye);
+    //Red is black outside the red box
+    Paint_FillImage(Xs, Ys, Xe, Ye, (Color == BLACK || Color == RED) ? 0x00 : 0xFF);
+    if(Paint.ImageRed == NULL)
+        return;
+
+    //Part inside the red box
+    RedXend = (Paint.RedXByte + Paint.RedWidthByte) * 8 - 1;
+    if(Xe < Paint.RedXByte * 8 || Xs > RedXend || Ye < Paint.RedY || Ys >= Paint.RedY + Paint.RedHeight)
+        return;
+    Xs = (Xs > Paint.RedXByte * 8) ? Xs : Paint.RedXByte * 8;
+    Xe = (Xe < RedXend) ? Xe : RedXend;
+    Ys = (Ys > Paint.RedY) ? Ys : Paint.RedY;
+    Ye = (Ye < Paint.RedY + Paint.RedHeight - 1) ? Ye : Paint.RedY + Paint.RedHeight - 1;
+
+    if(Color == RED)
+        Paint_FillImage(Xs, Ys, Xe, Ye, 0xFF); //Red shows over white
+    Xs -= Paint.RedXByte * 8;
+    Xe -= Paint.RedXByte * 8;
+    Ys -= Paint.RedY;
+    Ye -= Paint.RedY;
+    if(Paint.Layout == IMAGE_LAYOUT_COLUMNS)
+        Paint_FillBits(Paint.ImageRed, Paint.RedHeight, 1, Xs, Ys, Xe, Ye, (Color == RED) ? 0xFF : 0x00);
     else
-        Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
+        Paint_FillBits(Paint.ImageRed, 1, Paint.RedWidthByte, Xs, Ys, Xe, Ye, (Color == RED) ? 0xFF : 0x00);
+}
+
+/******************************************************************************
+function:	Fill what Paint_DrawPoint() draws on every point of a window
+parameter:
+    Xstart, Ystart, Xend, Yend : Window on the screen, inclusive
+    Color, Dot_Pixel : as Paint_DrawPoint() with DOT_FILL_AROUND
+******************************************************************************/
+static void Paint_FillDots(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                           UWORD Color, DOT_PIXEL Dot_Pixel)
+{
+    //A dot covers X - Dot_Pixel to X + Dot_Pixel - 2, cut at the screen edges
+    if(Xend + Dot_Pixel < 2 || Yend + Dot_Pixel < 2)
+        return;
+    Paint_FillWindow((Xstart > Dot_Pixel) ? Xstart - Dot_Pixel : 0,
+                     (Ystart > Dot_Pixel) ? Ystart - Dot_Pixel : 0,
+                     Xend + Dot_Pixel - 2, Yend + Dot_Pixel - 2, Color);
 }
 
 /******************************************************************************
@@ -160,14 +530,13 @@ parameter:
 ******************************************************************************/
 void Paint_Clear(UWORD Color)
 {
-	UWORD X,Y;
-	UDOUBLE Addr;
-    for (Y = 0; Y < Paint.HeightByte; Y++) {
-        for (X = 0; X < Paint.WidthByte; X++ ) {//8 pixel =  1 byte
-            Addr = X + Y*Paint.WidthByte;
-            Paint.Image[Addr] = Color;
-        }
-    }
+    if(Paint.ImageRed != NULL)
+        memset(Paint.ImageRed, (Color == RED)? 0xFF : 0x00, Paint.RedWidthByte * Paint.RedHeight);
+    memset(Paint.Image, (Color == RED)? BLACK : Color, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
+    //Red is black outside the red box and shows over white inside it
+    if(Color == RED && Paint.ImageRed != NULL)
+        Paint_FillImage(Paint.RedXByte * 8, Paint.RedY,
+                        (Paint.RedXByte + Paint.RedWidthByte) * 8 - 1, Paint.RedY + Paint.RedHeight - 1, 0xFF);
 }
 
 /******************************************************************************
@@ -175,17 +544,13 @@ function:	Clear the color of a window
 parameter:
     Xstart :   x starting point
     Ystart :   Y starting point
-    Xend   :   x end point
-    Yend   :   y end point
+    Xend   :   x end point, exclusive
+    Yend   :   y end point, exclusive
 ******************************************************************************/
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) {//8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
-        }
-    }
+    if (Xend > Xstart && Yend > Ystart)
+        Paint_FillWindow(Xstart, Ystart, Xend - 1, Yend - 1, Color);
 }
 
 /******************************************************************************
@@ -296,25 +661,46 @@ parameter:
 void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
                          UWORD Color, DRAW_FILL Filled, DOT_PIXEL Dot_Pixel)
 {
-	UWORD Ypoint;
+	UWORD Xmin, Xmax, Ymin, Ymax;
     if (Xstart > Paint.Width || Ystart > Paint.Height ||
         Xend > Paint.Width || Yend > Paint.Height) {
         //Debug("Input exceeds the normal display range\r\n");
         return;
     }
 
+    //Solid lines of dots, filled or not
+    Xmin = (Xstart < Xend) ? Xstart : Xend;
+    Xmax = (Xstart < Xend) ? Xend : Xstart;
     if (Filled ) {
-        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color , LINE_STYLE_SOLID, Dot_Pixel);
-        }
+        if (Yend > Ystart)
+            Paint_FillDots(Xmin, Ystart, Xmax, Yend - 1, Color, Dot_Pixel);
     } else {
-        Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color , LINE_STYLE_SOLID, Dot_Pixel);
-        Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color , LINE_STYLE_SOLID, Dot_Pixel);
-        Paint_DrawLine(Xend, Yend, Xend, Ystart, Color , LINE_STYLE_SOLID, Dot_Pixel);
-        Paint_DrawLine(Xend, Yend, Xstart, Yend, Color , LINE_STYLE_SOLID, Dot_Pixel);
+        Ymin = (Ystart < Yend) ? Ystart : Yend;
+        Ymax = (Ystart < Yend) ? Yend : Ystart;
+        Paint_FillDots(Xmin, Ystart, Xmax, Ystart, Color, Dot_Pixel);
+        Paint_FillDots(Xstart, Ymin, Xstart, Ymax, Color, Dot_Pixel);
+        Paint_FillDots(Xend, Ymin, Xend, Ymax, Color, Dot_Pixel);
+        Paint_FillDots(Xmin, Yend, Xmax, Yend, Color, Dot_Pixel);
     }
 }
 
+/******************************************************************************
+function:	Fill a row of a filled circle
+parameter:
+    X_Center  ：Center X coordinate
+    Ypoint    ：Row, may be above the screen
+    Half      ：Points left and right of the center
+    Color     ：The color of the circle
+******************************************************************************/
+static void Paint_FillCircleRow(UWORD X_Center, int Ypoint, int Half, UWORD Color)
+{
+    int Xstart = X_Center - Half;
+
+    if (Ypoint < 0 || Ypoint > Paint.Height)
+        return;
+    Paint_FillDots((Xstart > 0) ? Xstart : 0, Ypoint, X_Center + Half, Ypoint, Color, DOT_PIXEL_1X1);
+}
+
 /******************************************************************************
 function:	Use the 8-point method to draw a circle of the
             specified size at the specified position->
@@ -328,7 +714,7 @@ parameter:
 void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
                       UWORD Color, DRAW_FILL  Draw_Fill , DOT_PIXEL Dot_Pixel)
 {
-	int16_t Esp, sCountY;
+	int16_t Esp;
 	int16_t XCurrent, YCurrent;
     if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
         //Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
@@ -343,16 +729,11 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
    Esp = 3 - (Radius << 1 );
     if (Draw_Fill == DRAW_FILL_FULL) {
         while (XCurrent <= YCurrent ) { //Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY ++ ) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);//7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
+            //Rows the 8 octants reach at this step, drawn as spans
+            Paint_FillCircleRow(X_Center, Y_Center + XCurrent, YCurrent, Color);
+            Paint_FillCircleRow(X_Center, Y_Center - XCurrent, YCurrent, Color);
+            Paint_FillCircleRow(X_Center, Y_Center + YCurrent, XCurrent, Color);
+            Paint_FillCircleRow(X_Center, Y_Center - YCurrent, XCurrent, Color);
             if (Esp < 0 )
                 Esp += 4 * XCurrent + 6;
             else {
@@ -383,6 +764,183 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
     }
 }
 
+/******************************************************************************
+function:	Write a run of pixels along the bits of the image memory
+parameter:
+    Data    :   First byte of the run
+    Bit     :   Bit of the first pixel from the msb of Data, may pass 7
+    Bits    :   Pixels from the msb, set for the foreground
+    Count   :   Number of pixels, up to 32
+    Stride  :   Bytes from one byte of the run to the next
+    Ink     :   Colors of the run
+******************************************************************************/
+typedef struct {
+    UBYTE InkBlack;     //0xFF if the foreground is black
+    UBYTE PaperBlack;   //0xFF if the background is black
+    UBYTE Paper;        //0xFF if the background is drawn
+} PAINT_INK;
+
+static void Paint_WriteBits(UBYTE *Data, UWORD Bit, UDOUBLE Bits, UBYTE Count,
+                            UWORD Stride, const PAINT_INK *Ink)
+{
+    UBYTE N, Mask, Glyph, Paper, Black;
+
+    Data += (Bit / 8) * Stride;
+    Bit %= 8;
+    while (Count > 0) {
+        N = (Count < 8 - Bit) ? Count : 8 - Bit;
+        Mask = (0xFF >> Bit) & ~(0xFF >> (Bit + N));
+        Glyph = (UBYTE)(Bits >> (24 + Bit)) & Mask;
+        Paper = ~Glyph & Mask & Ink->Paper;
+        Black = (Glyph & Ink->InkBlack) | (Paper & Ink->PaperBlack);
+        *Data = (*Data & ~Black) | ((Glyph | Paper) & ~Black);
+
+        Bits <<= N;
+        Count -= N;
+        Bit = 0;
+        Data += Stride;
+    }
+}
+
+static UDOUBLE Paint_Reverse(UDOUBLE Bits)
+{
+    Bits = ((Bits >> 1) & 0x55555555) | ((Bits & 0x55555555) << 1);
+    Bits = ((Bits >> 2) & 0x33333333) | ((Bits & 0x33333333) << 2);
+    Bits = ((Bits >> 4) & 0x0F0F0F0F) | ((Bits & 0x0F0F0F0F) << 4);
+    Bits = ((Bits >> 8) & 0x00FF00FF) | ((Bits & 0x00FF00FF) << 8);
+    return (Bits >> 16) | (Bits << 16);
+}
+
+//Leading zeros of Bits, not 0
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3U)
+#define Paint_Clz(Bits) __CLZ(Bits)
+#else
+static UBYTE Paint_Clz(UDOUBLE Bits)
+{
+    UBYTE N = 0;
+    if (!(Bits & 0xFFFF0000)) { N += 16; Bits <<= 16; }
+    if (!(Bits & 0xFF000000)) { N += 8; Bits <<= 8; }
+    if (!(Bits & 0xF0000000)) { N += 4; Bits <<= 4; }
+    if (!(Bits & 0xC0000000)) { N += 2; Bits <<= 2; }
+    if (!(Bits & 0x80000000)) { N += 1; }
+    return N;
+}
+#endif
+
+/******************************************************************************
+function:	Tell if a screen window has points in the red box. Black and white
+            clear the red under them, which only Paint_SetPixel() does.
+parameter:
+    Xstart, Ystart, Xend, Yend : Window on the screen, inclusive
+******************************************************************************/
+static UBYTE Paint_RedOverlaps(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    UWORD Xs, Ys, Xe, Ye;
+
+    if (Paint.ImageRed == NULL)
+        return 0;
+    Paint_GetMemoryWindow(Xstart, Ystart, Xend, Yend, &Xs, &Ys, &Xe, &Ye);
+    return (Xe / 8 >= Paint.RedXByte && Xs / 8 < Paint.RedXByte + Paint.RedWidthByte &&
+            Ye >= Paint.RedY && Ys < Paint.RedY + Paint.RedHeight);
+}
+
+/******************************************************************************
+function:	Draw a glyph a run of pixels at a time
+parameter:
+    Xpoint, Ypoint   ：Top left corner on the screen
+    ptr              ：Glyph in the font table
+    columns          ：Same glyph in the font columns table, NULL if none
+    Font, Color_Background, Color_Foreground : as Paint_DrawChar()
+return:
+    0 if the glyph has to be drawn pixel by pixel: it is clipped, has red
+    or touches the red box
+******************************************************************************/
+static UBYTE Paint_BlitChar(UWORD Xpoint, UWORD Ypoint, const unsigned char *ptr,
+                            const unsigned char *columns, sFONT* Font,
+                            UWORD Color_Background, UWORD Color_Foreground)
+{
+    UDOUBLE Rows[32], Columns[32], Bits;
+    UWORD Width = Font->Width, Height = Font->Height;
+    UWORD RowBytes = (Width + 7) / 8, ColumnBytes = (Height + 7) / 8;
+    UWORD i, j, X, Y;
+    UBYTE Flip, Transposed;
+    PAINT_INK Ink;
+
+    if (Paint_Writer == PAINT_WRITER_NONE || Width > 32 || Height > 32)
+        return 0;
+    if (Xpoint + Width > Paint.Width || Ypoint + Height > Paint.Height)
+        return 0;
+    if (Color_Foreground == RED || Color_Background == RED)
+        return 0;
+    if (Paint_RedOverlaps(Xpoint, Ypoint, Xpoint + Width - 1, Ypoint + Height - 1))
+        return 0;
+
+    Ink.InkBlack = (Color_Foreground == BLACK) ? 0xFF : 0x00;
+    Ink.PaperBlack = (Color_Background == BLACK) ? 0xFF : 0x00;
+    Ink.Paper = (FONT_BACKGROUND == Color_Background) ? 0x00 : 0xFF;
+
+    Transposed = (Paint_Writer == PAINT_WRITER_COLUMNS || (Paint_Writer & 4));
+    if (Transposed && columns != NULL) {
+        //Glyph columns from the msb, as they are in the table
+        for (i = 0; i < Width; i++) {
+            Bits = 0;
+            for (j = 0; j < ColumnBytes; j++)
+                Bits |= (UDOUBLE)columns[j] << (24 - 8 * j);
+            Columns[i] = Bits;
+            columns += ColumnBytes;
+        }
+    } else {
+        //Glyph rows from the msb
+        for (j = 0; j < Height; j++) {
+            Bits = 0;
+            for (i = 0; i < RowBytes; i++)
+                Bits |= (UDOUBLE)ptr[i] << (24 - 8 * i);
+            Rows[j] = (Width < 32) ? Bits & ~(0xFFFFFFFF >> Width) : Bits;
+            ptr += RowBytes;
+        }
+    }
+
+    if (Transposed && columns == NULL) {
+        //Glyph columns from the msb, a step per set pixel
+        memset(Columns, 0, Width * sizeof(UDOUBLE));
+        for (j = 0; j < Height; j++) {
+            for (Bits = Rows[j]; Bits != 0; Bits &= ~(0x80000000 >> i)) {
+                i = Paint_Clz(Bits);
+                Columns[i] |= 0x80000000 >> j;
+            }
+        }
+    }
+
+    if (Paint_Writer == PAINT_WRITER_COLUMNS) {
+        //Glyph columns run down the memory columns
+        for (i = 0; i < Width; i++)
+            Paint_WriteBits(&Paint.Image[Xpoint + i], Ypoint, Columns[i], Height, Paint.HeightMemory, &Ink);
+        return 1;
+    }
+
+    Flip = Paint_Writer & MIRROR_ORIGIN;
+    if (!(Paint_Writer & 4)) {
+        //Glyph rows are memory rows
+        X = (Flip & MIRROR_HORIZONTAL) ? Paint.WidthMemory - Xpoint - Width : Xpoint;
+        for (j = 0; j < Height; j++) {
+            Y = (Flip & MIRROR_VERTICAL) ? Paint.HeightMemory - Ypoint - j - 1 : Ypoint + j;
+            Bits = (Flip & MIRROR_HORIZONTAL) ? Paint_Reverse(Rows[j]) << (32 - Width) : Rows[j];
+            Paint_WriteBits(&Paint.Image[Y * Paint.WidthByte], X, Bits, Width, 1, &Ink);
+        }
+    } else {
+        //Glyph columns are memory rows
+        X = (Flip & MIRROR_HORIZONTAL) ? Paint.WidthMemory - Ypoint - Height : Ypoint;
+        for (i = 0; i < Width; i++) {
+            Y = (Flip & MIRROR_VERTICAL) ? Paint.HeightMemory - Xpoint - i - 1 : Xpoint + i;
+            Bits = Columns[i];
+            if (Flip & MIRROR_HORIZONTAL)
+                Bits = Paint_Reverse(Bits) << (32 - Height);
+            Paint_WriteBits(&Paint.Image[Y * Paint.WidthByte], X, Bits, Height, 1, &Ink);
+        }
+    }
+    return 1;
+}
+
 /******************************************************************************
 function:	Show English characters
 parameter:
@@ -398,7 +956,7 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
 {
     UWORD  Page, Column;
 	  uint32_t  Char_Offset;
-	 const unsigned char *ptr;
+	 const unsigned char *ptr, *columns;
 
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         //Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
@@ -407,6 +965,11 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
 
     Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     ptr = &Font->table[Char_Offset];
+    columns = (Font->columns != NULL && Acsii_Char >= FONT_COLUMNS_FIRST && Acsii_Char <= FONT_COLUMNS_LAST) ?
+              &Font->columns[(Acsii_Char - FONT_COLUMNS_FIRST) * Font->Width * ((Font->Height + 7) / 8)] : NULL;
+
+    if (Paint_BlitChar(Xpoint, Ypoint, ptr, columns, Font, Color_Background, Color_Foreground))
+        return;
 
     for (Page = 0; Page < Font->Height; Page ++ ) {
         for (Column = 0; Column < Font->Width; Column ++ ) {
@@ -654,20 +1217,78 @@ void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font,
 /******************************************************************************
 function:	Display monochrome bitmap
 parameter:
-    image_buffer ：A picture data converted to a bitmap
+    Bitmap ：Bitmap and its size, see PAINT_BITMAP_ROWS/COLUMNS
+    Xstart ：X coordinate of its top left corner
+    Ystart ：Y coordinate of its top left corner
 info:
-    Use a computer to convert the image into a corresponding array,
-    and then embed the array directly into Imagedata.cpp as a .c file.
+    The bitmap is cut at the screen edges. Lines that run along the image
+    memory rows, bitmap columns on the tag canvas, are copied with shifts
+    at any position. Others, and bitmaps over red, go pixel by pixel.
 ******************************************************************************/
-void Paint_DrawBitMap(const unsigned char* image_buffer, int width, int height, int width_offset, int height_offset)
-{
-    UWORD x, y;
-    uint32_t width_byte = width / 8;
-    uint32_t epd_width_byte = EPD_WIDTH % 8 ? EPD_WIDTH/8+1 : EPD_WIDTH/8;
-    for (y = 0; y < height; y++) {
-        for (x = 0; x < width_byte; x++) { //8 pixel =  1 byte
-            // 2 bytes for alignment
-            Paint.Image[x + width_offset + (y+height_offset) * (epd_width_byte)] = image_buffer[x + y * width_byte];
+void Paint_DrawBitMap(const PAINT_BITMAP *Bitmap, UWORD Xstart, UWORD Ystart)
+{
+    const PAINT_INK Ink = { 0x00, 0xFF, 0xFF }; //Set bits white, others black
+    const UBYTE *Line;
+    UDOUBLE Bits;
+    UWORD Xend, Yend, Lines, Count, LineBytes, i, k, n, j;
+    UWORD Xs, Ys, Xe, Ye, Bit, Stride;
+    UBYTE Columns = (Bitmap->Scan == BITMAP_SCAN_COLUMNS);
+    UBYTE Transposed, Reverse;
+    UBYTE *Data;
+
+    if (Paint_Writer == PAINT_WRITER_NONE || Xstart >= Paint.Width || Ystart >= Paint.Height ||
+        Bitmap->Width == 0 || Bitmap->Height == 0)
+        return;
+    Xend = ((UDOUBLE)Xstart + Bitmap->Width > Paint.Width) ? Paint.Width - 1 : Xstart + Bitmap->Width - 1;
+    Yend = ((UDOUBLE)Ystart + Bitmap->Height > Paint.Height) ? Paint.Height - 1 : Ystart + Bitmap->Height - 1;
+
+    //Visible lines and pixels of a line
+    Lines = Columns ? Xend - Xstart + 1 : Yend - Ystart + 1;
+    Count = Columns ? Yend - Ystart + 1 : Xend - Xstart + 1;
+    LineBytes = Columns ? (Bitmap->Height + 7) / 8 : (Bitmap->Width + 7) / 8;
+
+    Transposed = (Paint_Writer == PAINT_WRITER_COLUMNS || (Paint_Writer & 4));
+    if (Columns != Transposed || Paint_RedOverlaps(Xstart, Ystart, Xend, Yend)) {
+        for (i = 0; i < Lines; i++) {
+            Line = &Bitmap->Data[(UDOUBLE)i * LineBytes];
+            for (k = 0; k < Count; k++) {
+                if (Columns)
+                    Paint_WritePixel(Xstart + i, Ystart + k, (Line[k / 8] & (0x80 >> (k % 8))) ? WHITE : BLACK);
+                else
+                    Paint_WritePixel(Xstart + k, Ystart + i, (Line[k / 8] & (0x80 >> (k % 8))) ? WHITE : BLACK);
+            }
+        }
+        return;
+    }
+
+    Reverse = (Paint_Writer != PAINT_WRITER_COLUMNS && (Paint_Writer & MIRROR_HORIZONTAL));
+    Stride = (Paint_Writer == PAINT_WRITER_COLUMNS) ? Paint.HeightMemory : 1;
+    for (i = 0; i < Lines; i++) {
+        Line = &Bitmap->Data[(UDOUBLE)i * LineBytes];
+        if (Columns)
+            Paint_GetMemoryWindow(Xstart + i, Ystart, Xstart + i, Yend, &Xs, &Ys, &Xe, &Ye);
+        else
+            Paint_GetMemoryWindow(Xstart, Ystart + i, Xend, Ystart + i, &Xs, &Ys, &Xe, &Ye);
+        Data = (Stride == 1) ? &Paint.Image[Ys * Paint.WidthByte] : &Paint.Image[Ys];
+
+        k = 0;
+        if (!Reverse && Xs % 8 == 0 && Stride == 1) {
+            //Byte aligned, whole bytes are a copy
+            memcpy(&Data[Xs / 8], Line, Count / 8);
+            k = Count & ~7;
+        }
+        for (; k < Count; k += n) {
+            n = (Count - k < 32) ? Count - k : 32;
+            Bits = 0;
+            for (j = 0; j < (n + 7) / 8; j++)
+                Bits |= (UDOUBLE)Line[k / 8 + j] << (24 - 8 * j);
+            if (Reverse) {
+                Bit = Xe - k - n + 1;
+                Bits = Paint_Reverse(Bits) << (32 - n);
+            } else {
+                Bit = Xs + k;
+            }
+            Paint_WriteBits(Data, Bit, Bits, n, Stride, &Ink);
         }
     }
 }
@@ -24,6 +24,12 @@ typedef struct {
     UWORD Mirror;
     UWORD WidthByte;
     UWORD HeightByte;
+    UWORD Layout;
+    UBYTE *ImageRed;    //Red box, NULL if there is no red
+    UWORD RedXByte;     //Box position and size in the image memory
+    UWORD RedY;
+    UWORD RedWidthByte;
+    UWORD RedHeight;
 } PAINT;
 extern PAINT Paint;
 
@@ -46,12 +52,20 @@ typedef enum {
 } MIRROR_IMAGE;
 #define MIRROR_IMAGE_DFT MIRROR_NONE
 
+/**
+ * Image memory layout
+**/
+typedef enum {
+    IMAGE_LAYOUT_ROWS = 0x00,     //Bytes run along the memory rows
+    IMAGE_LAYOUT_COLUMNS = 0x01,  //Bytes run down the memory columns, screen is the memory transposed
+} IMAGE_LAYOUT;
+
 /**
  * image color
 **/
 #define WHITE          0xFF
 #define BLACK          0x00
-#define RED            BLACK
+#define RED            0x0F  //Only inside the red box, black elsewhere
 
 #define IMAGE_BACKGROUND    WHITE
 #define FONT_FOREGROUND     BLACK
@@ -97,6 +111,27 @@ typedef enum {
     DRAW_FILL_FULL,
 } DRAW_FILL;
 
+/**
+ * Monochrome bitmap, set bits are white
+**/
+typedef enum {
+    BITMAP_SCAN_ROWS = 0x00,     //Lines are rows, left to right from the msb
+    BITMAP_SCAN_COLUMNS = 0x01,  //Lines are columns, top to bottom from the msb
+} BITMAP_SCAN;
+
+typedef struct {
+    const UBYTE *Data;  //Lines of whole bytes, first line first
+    UWORD Width;
+    UWORD Height;
+    UBYTE Scan;
+} PAINT_BITMAP;
+
+//Describe a bitmap array, the number of lines comes from its size
+#define PAINT_BITMAP_ROWS(Data, Width) \
+    { (Data), (Width), sizeof(Data) / (((Width) + 7) / 8), BITMAP_SCAN_ROWS }
+#define PAINT_BITMAP_COLUMNS(Data, Height) \
+    { (Data), sizeof(Data) / (((Height) + 7) / 8), (Height), BITMAP_SCAN_COLUMNS }
+
 /**
  * Custom structure of a time attribute
 **/
@@ -113,9 +148,13 @@ extern PAINT_TIME sPaint_time;
 //init and Clear
 void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
 void Paint_SelectImage(UBYTE *image);
+void Paint_SelectRedImage(UBYTE *image, UDOUBLE Size, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
 void Paint_SetRotate(UWORD Rotate);
 void Paint_SetMirroring(UBYTE mirror);
+void Paint_SetLayout(UBYTE layout);
 void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
+void Paint_GetMemoryWindow(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                           UWORD *pXstart, UWORD *pYstart, UWORD *pXend, UWORD *pYend);
 
 void Paint_Clear(UWORD Color);
 void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
@@ -134,7 +173,7 @@ void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT* Font, UWO
 void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT* Font, UWORD Color_Background, UWORD Color_Foreground);
 
 //pic
-void Paint_DrawBitMap(const unsigned char* image_buffer, int width, int height, int width_offset, int height_offset);
+void Paint_DrawBitMap(const PAINT_BITMAP *Bitmap, UWORD Xstart, UWORD Ystart);
 
 
 #endif
@@ -68,6 +68,15 @@
 
 #define BATTERY_LEVEL_MEAS_INTERVAL     APP_TIMER_TICKS(30000)                 /**< Battery level measurement interval (ticks). */
 
+/* Frames streamed through the eink characteristic, see EPD_Stream. The text
+   of a screen never starts with these bytes. The panel wakes up on BEGIN,
+   DATA written before it is ready, within a connection interval, is refused
+   and the stream ends without a refresh. */
+#define EINK_STREAM_BEGIN               0x01                                    /**< Optional window: x_start, y_start, x_end, y_end, 16 bit little endian. */
+#define EINK_STREAM_DATA                0x02                                    /**< Run-length coded window bytes. */
+#define EINK_STREAM_END                 0x03                                    /**< Refresh once the window is filled. */
+#define EINK_STREAM_WINDOW_LEN          9
+
 static uint16_t m_conn_handle = BLE_CONN_HANDLE_INVALID;                        /**< Handle of the current connection. */
 
 static uint8_t m_adv_handle = BLE_GAP_ADV_SET_HANDLE_NOT_SET;                   /**< Advertising handle used to identify an advertising set. */
@@ -311,6 +320,45 @@ static void ble_stack_init()
   NRF_SDH_BLE_OBSERVER(m_ble_observer, APP_BLE_OBSERVER_PRIO, ble_evt_handler, NULL);
 }
 
+/**@brief Function for passing a write of a streamed frame to the display.
+ */
+static void eink_stream_write(const uint8_t * data, uint16_t data_len)
+{
+  ret_code_t err_code;
+  EPD_Window window;
+
+  switch (data[0])
+  {
+    case EINK_STREAM_BEGIN:
+      if (data_len >= EINK_STREAM_WINDOW_LEN)
+      {
+        window.x_start = uint16_decode(&data[1]);
+        window.y_start = uint16_decode(&data[3]);
+        window.x_end = uint16_decode(&data[5]);
+        window.y_end = uint16_decode(&data[7]);
+        err_code = display_stream_begin(&window);
+      }
+      else
+      {
+        err_code = display_stream_begin(NULL);
+      }
+      break;
+
+    case EINK_STREAM_DATA:
+      err_code = display_stream_write(&data[1], data_len - 1);
+      break;
+
+    default:
+      err_code = display_stream_end();
+      break;
+  }
+
+  if (err_code != NRF_SUCCESS)
+  {
+    NRF_LOG_WARNING("Frame stream: write 0x%02x failed, error %d", data[0], err_code);
+  }
+}
+
 /**@brief Function for handling write events to the EINK characteristic.
  *
  * @param[in] p_eink_service  Instance of eink Service to which the write applies.
@@ -324,8 +372,14 @@ static void ble_stack_init()
  */ 
 static void eink_write_handler(uint16_t conn_handle, ble_eink_service_t * p_eink_service, uint8_t * data, uint16_t data_len)
 {
+  if (data_len > 0 && data[0] >= EINK_STREAM_BEGIN && data[0] <= EINK_STREAM_END)
+  {
+    eink_stream_write(data, data_len);
+    return;
+  }
+
   NRF_LOG_INFO("Displaying Reserved Screen...");
-  unsigned char* str_data = (unsigned char*) calloc(data_len, sizeof(unsigned char));
+  unsigned char* str_data = (unsigned char*) calloc(data_len + 1, sizeof(unsigned char));
   memcpy(str_data, data, data_len);
   str_data[data_len] = 0;
   
@@ -426,11 +480,6 @@ static void idle_state_handle()
   }
 }
 
-static void spi_init()
-{
-  APP_ERROR_CHECK(epd_spi_init());
-}
-
 static void advertising_start()
 {
   ret_code_t err_code = ble_advertising_start(&m_advertising, BLE_ADV_MODE_FAST);
@@ -440,9 +489,8 @@ static void advertising_start()
 int main(void) 
 {
   log_init();
-  spi_init();
-  screen_init();
   timers_init();
+  screen_init();
   ble_stack_init();
   gap_params_init();
   gatt_init();
@@ -0,0 +1,199 @@
+/** @file epd_stubs.c
+ *
+ * @brief Host stand-ins for what epd.c and epdif.c call outside the
+ *        blocking driver: SDK drivers, the panel rail and the refresh
+ *        engine. The panel itself is the trace transport.
+*/
+
+#include "app_timer.h"
+#include "nrf_delay.h"
+#include "nrf_drv_spi.h"
+#include "nrf_gpio.h"
+#include "nrf_soc.h"
+#include "epd_power.h"
+#include "epd_refresh.h"
+
+void nrf_gpio_pin_dir_set(uint32_t pin_number, int direction)
+{
+  (void)pin_number;
+  (void)direction;
+}
+
+void nrf_gpio_cfg_input(uint32_t pin_number, int pull_config)
+{
+  (void)pin_number;
+  (void)pull_config;
+}
+
+void nrf_gpio_pin_write(uint32_t pin_number, uint32_t value)
+{
+  (void)pin_number;
+  (void)value;
+}
+
+uint32_t nrf_gpio_pin_read(uint32_t pin_number)
+{
+  (void)pin_number;
+  return 0;
+}
+
+void nrf_delay_ms(uint32_t ms_time)
+{
+  (void)ms_time;
+}
+
+uint32_t sd_temp_get(int32_t *p_temp)
+{
+  *p_temp = 25 * 4;
+  return NRF_SUCCESS;
+}
+
+ret_code_t nrf_drv_spi_init(nrf_drv_spi_t const *p_instance, nrf_drv_spi_config_t const *p_config,
+                            nrf_drv_spi_evt_handler_t handler, void *p_context)
+{
+  (void)p_instance;
+  (void)p_config;
+  (void)handler;
+  (void)p_context;
+  return NRF_SUCCESS;
+}
+
+void nrf_drv_spi_uninit(nrf_drv_spi_t const *p_instance)
+{
+  (void)p_instance;
+}
+
+ret_code_t nrf_drv_spi_transfer(nrf_drv_spi_t const *p_instance, uint8_t const *p_tx_buffer,
+                                uint8_t tx_buffer_length, uint8_t *p_rx_buffer,
+                                uint8_t rx_buffer_length)
+{
+  (void)p_instance;
+  (void)p_tx_buffer;
+  (void)tx_buffer_length;
+  (void)p_rx_buffer;
+  (void)rx_buffer_length;
+  return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_create(app_timer_id_t const *p_timer_id, app_timer_mode_t mode,
+                            app_timer_timeout_handler_t timeout_handler)
+{
+  (void)p_timer_id;
+  (void)mode;
+  (void)timeout_handler;
+  return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_start(app_timer_id_t timer_id, uint32_t timeout_ticks, void *p_context)
+{
+  (void)timer_id;
+  (void)timeout_ticks;
+  (void)p_context;
+  return NRF_SUCCESS;
+}
+
+ret_code_t app_timer_stop(app_timer_id_t timer_id)
+{
+  (void)timer_id;
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_power_init(void)
+{
+  return NRF_SUCCESS;
+}
+
+bool epd_power_up(void)
+{
+  return false;
+}
+
+void epd_power_down(void)
+{
+}
+
+ret_code_t epd_refresh_init(EPD *p_epd)
+{
+  (void)p_epd;
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_start(const unsigned char *frame_buffer_black,
+                             const EPD_RedPlane *p_red,
+                             epd_refresh_done_handler_t done_handler)
+{
+  (void)frame_buffer_black;
+  (void)p_red;
+  (void)done_handler;
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_start_region(const unsigned char *frame_buffer_black,
+                                    const EPD_Window *p_window,
+                                    epd_refresh_done_handler_t done_handler)
+{
+  (void)frame_buffer_black;
+  (void)p_window;
+  (void)done_handler;
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_clean(const unsigned char *frame_buffer_black,
+                             const EPD_RedPlane *p_red,
+                             epd_refresh_done_handler_t done_handler)
+{
+  (void)frame_buffer_black;
+  (void)p_red;
+  (void)done_handler;
+  return NRF_SUCCESS;
+}
+
+void epd_refresh_release_handler_set(epd_refresh_done_handler_t release_handler)
+{
+  (void)release_handler;
+}
+
+ret_code_t epd_refresh_stream_begin(const EPD_Window *p_window,
+                                    epd_refresh_done_handler_t ready_handler)
+{
+  (void)p_window;
+  (void)ready_handler;
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_stream_write(const uint8_t *p_data, uint16_t len)
+{
+  (void)p_data;
+  (void)len;
+  return NRF_SUCCESS;
+}
+
+ret_code_t epd_refresh_stream_end(epd_refresh_done_handler_t done_handler)
+{
+  (void)done_handler;
+  return NRF_SUCCESS;
+}
+
+bool epd_refresh_ghosting_get(void)
+{
+  return false;
+}
+
+void epd_refresh_waveform_set(EPD_Waveform waveform)
+{
+  (void)waveform;
+}
+
+epd_refresh_state_t epd_refresh_state_get(void)
+{
+  return EPD_REFRESH_IDLE;
+}
+
+ret_code_t epd_refresh_result_get(void)
+{
+  return NRF_SUCCESS;
+}
+
+void epd_refresh_stats_log(void)
+{
+}
@@ -0,0 +1,450 @@
+/** @file epd_trace_test.c
+ *
+ * @brief Runs the blocking EPD driver over the trace transport and checks
+ *        the byte stream epdif_trace.c records.
+ *
+ * @par
+ * The trace is read back and played into a model of the controller: RAM
+ * window, address counters and data entry mode of the SSD1680, partial
+ * window of the UC8151. After every step the RAM planes must hold the
+ * canvas with white margins. The init records of the panel must all be
+ * in the trace, the sleep must end it, and the SPI statistics must count
+ * every byte of it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app_error.h"
+#include "epdif.h"
+#include "epd.h"
+
+#define TEST_MAX_FAILS 20
+
+/* Gates of the panel RAM: RAM Y address on SSD1680, gate on UC8151 */
+#define TEST_GATE(row) ((epd.panel->controller == EPD_CONTROLLER_UC8151) ? \
+                        EPD_WHITE_SPACE / 2 + (row) : EPD_RAM_Y(row))
+
+/* Controller model */
+static unsigned char m_plane[2][EPD_HEIGHT][EPD_WIDTH_BYTES]; // New, old
+static int m_plane_sel = -1;
+static unsigned int m_entry, m_x_start, m_x_end, m_y_start, m_y_end, m_x, m_y;
+static int m_partial;
+static int m_cmd_open;                 // Command whose data may still come
+static unsigned char m_cmd, m_args[16];
+static unsigned int m_nargs;
+
+/* Trace read back */
+static FILE *mp_trace;
+static unsigned long m_trace_bytes;
+static unsigned char m_log_cmd[4096];
+static unsigned char m_log_args[4096][16];
+static unsigned int m_log_nargs[4096];
+static unsigned int m_log_len;
+
+static EPD epd;
+static unsigned char m_canvas[EPD_SCREEN_HEIGHT * EPD_WIDTH_BYTES];
+static unsigned char m_stream[2 * sizeof(m_canvas)];
+static unsigned int m_fails;
+
+static void fail(const char *what)
+{
+  if (m_fails++ < TEST_MAX_FAILS)
+  {
+    printf("%s\n", what);
+  }
+}
+
+static unsigned int arg16(unsigned int i)
+{
+  return m_args[i] | (m_args[i + 1] << 8);
+}
+
+/**@brief Settings take effect once all their data is in.
+ */
+static void model_apply(void)
+{
+  if (!m_cmd_open)
+  {
+    return;
+  }
+  m_cmd_open = 0;
+
+  if (m_log_len < sizeof(m_log_cmd))
+  {
+    m_log_cmd[m_log_len] = m_cmd;
+    memcpy(m_log_args[m_log_len], m_args, sizeof(m_args));
+    m_log_nargs[m_log_len++] = m_nargs;
+  }
+
+  if (epd.panel->controller == EPD_CONTROLLER_UC8151)
+  {
+    if (m_cmd == PARTIAL_IN)
+      m_partial = 1;
+    else if (m_cmd == PARTIAL_OUT)
+      m_partial = 0;
+    else if (m_cmd == PARTIAL_WINDOW && m_nargs >= 8)
+    {
+      m_x_start = ((m_args[0] << 8) | m_args[1]) / 8;
+      m_x_end = ((m_args[2] << 8) | m_args[3]) / 8;
+      m_y_start = (m_args[4] << 8) | m_args[5];
+      m_y_end = (m_args[6] << 8) | m_args[7];
+    }
+    return;
+  }
+
+  switch (m_cmd)
+  {
+    case 0x11: m_entry = m_args[0]; break;
+    case 0x44: m_x_start = m_args[0]; m_x_end = m_args[1]; break;
+    case 0x45: m_y_start = arg16(0); m_y_end = arg16(2); break;
+    case 0x4E: m_x = m_args[0]; break;
+    case 0x4F: m_y = arg16(0); break;
+    default: break;
+  }
+}
+
+static void model_command(unsigned char cmd)
+{
+  model_apply();
+  m_cmd = cmd;
+  m_cmd_open = 1;
+  m_nargs = 0;
+  m_plane_sel = (cmd == epd.panel->cmd_ram_new) ? 0 : (cmd == epd.panel->cmd_ram_old) ? 1 : -1;
+
+  if (m_plane_sel >= 0 && epd.panel->controller == EPD_CONTROLLER_UC8151)
+  {
+    // Data starts over at the window, or the whole panel outside partial mode
+    if (!m_partial)
+    {
+      m_x_start = 0;
+      m_x_end = EPD_WIDTH_BYTES - 1;
+      m_y_start = 0;
+      m_y_end = EPD_HEIGHT - 1;
+    }
+    m_x = m_x_start;
+    m_y = m_y_start;
+  }
+}
+
+/**@brief One counter steps, back to its start once it passed its end.
+ */
+static int counter_step(unsigned int *p_counter, unsigned int start, unsigned int end, int inc)
+{
+  if (*p_counter == end)
+  {
+    *p_counter = start;
+    return 1;
+  }
+  *p_counter += inc ? 1 : -1;
+  return 0;
+}
+
+static void model_data(unsigned char data)
+{
+  if (m_plane_sel < 0)
+  {
+    if (m_nargs < sizeof(m_args))
+    {
+      m_args[m_nargs++] = data;
+    }
+    return;
+  }
+
+  if (m_x >= EPD_WIDTH_BYTES || m_y >= EPD_HEIGHT)
+  {
+    fail("RAM write out of the panel");
+    return;
+  }
+  m_plane[m_plane_sel][m_y][m_x] = data;
+
+  if (epd.panel->controller == EPD_CONTROLLER_UC8151)
+  {
+    if (counter_step(&m_x, m_x_start, m_x_end, 1))
+      counter_step(&m_y, m_y_start, m_y_end, 1);
+  }
+  else if (m_entry & 0x04)
+  {
+    if (counter_step(&m_y, m_y_start, m_y_end, m_entry & 0x02))
+      counter_step(&m_x, m_x_start, m_x_end, m_entry & 0x01);
+  }
+  else
+  {
+    if (counter_step(&m_x, m_x_start, m_x_end, m_entry & 0x01))
+      counter_step(&m_y, m_y_start, m_y_end, m_entry & 0x02);
+  }
+}
+
+/**@brief Play the trace written since the last call into the model.
+ */
+static void trace_replay(void)
+{
+  static char line[1 << 17];
+  char *p;
+  unsigned int value, len;
+
+  epd_spi_uninit(); // Flushes the trace file
+  m_log_len = 0;
+
+  while (fgets(line, sizeof(line), mp_trace) != NULL)
+  {
+    p = line + 1;
+    switch (line[0])
+    {
+      case 'C':
+        sscanf(p, "%x", &value);
+        m_trace_bytes++;
+        model_command(value);
+        break;
+      case 'D':
+        while (*p == ' ' && sscanf(p, " %x", &value) == 1)
+        {
+          m_trace_bytes++;
+          model_data(value);
+          p += 3;
+        }
+        break;
+      case 'F':
+        sscanf(p, "%x %u", &value, &len);
+        m_trace_bytes += len;
+        while (len-- > 0)
+          model_data(value);
+        break;
+      default:
+        break;
+    }
+  }
+  model_apply();
+  clearerr(mp_trace);
+}
+
+/**@brief Bytes of a canvas window in the order the RAM takes them.
+ */
+static unsigned int window_bytes(const EPD_Window *window, unsigned char *p_out)
+{
+  unsigned int xb, row, n = 0;
+
+#if EPD_NATIVE_ORIENTATION
+  for (xb = window->x_start / 8; xb <= window->x_end / 8; xb++)
+    for (row = window->y_start; row <= window->y_end; row++)
+      p_out[n++] = m_canvas[EPD_FB_INDEX(xb, row)];
+#else
+  for (row = window->y_start; row <= window->y_end; row++)
+    for (xb = window->x_start / 8; xb <= window->x_end / 8; xb++)
+      p_out[n++] = m_canvas[EPD_FB_INDEX(xb, row)];
+#endif
+  return n;
+}
+
+/**@brief Plane must hold the canvas, white around it.
+ */
+static void check_plane(const char *what, int plane)
+{
+  unsigned int gate, row, xb;
+  unsigned char expected;
+
+  for (gate = 0; gate < EPD_HEIGHT; gate++)
+  {
+    for (xb = 0; xb < EPD_WIDTH_BYTES; xb++)
+    {
+      expected = 0xFF;
+      for (row = 0; row < EPD_SCREEN_HEIGHT; row++)
+      {
+        if (TEST_GATE(row) == gate)
+        {
+          expected = m_canvas[EPD_FB_INDEX(xb, row)];
+          break;
+        }
+      }
+      if (m_plane[plane][gate][xb] != expected)
+      {
+        printf("%s: plane %d gate %u byte %u is %02X, not %02X\n", what, plane, gate, xb,
+               m_plane[plane][gate][xb], expected);
+        fail(what);
+        return;
+      }
+    }
+  }
+}
+
+/**@brief Records of a sequence must be in the trace, in order and back to back.
+ */
+static void check_sequence(const char *what, const unsigned char *sequence)
+{
+  unsigned int i, start;
+  const unsigned char *p;
+
+  for (start = 0; start < m_log_len; start++)
+  {
+    for (p = sequence, i = start; p[1] != EPD_SEQ_END; p += 2 + (p[1] & EPD_SEQ_LEN_MASK), i++)
+    {
+      if (i >= m_log_len || m_log_cmd[i] != p[0] ||
+          m_log_nargs[i] != (p[1] & EPD_SEQ_LEN_MASK) ||
+          memcmp(m_log_args[i], &p[2], p[1] & EPD_SEQ_LEN_MASK) != 0)
+      {
+        break;
+      }
+    }
+    if (p[1] == EPD_SEQ_END)
+    {
+      return;
+    }
+  }
+  fail(what);
+}
+
+static void fill_canvas(unsigned int seed)
+{
+  unsigned int i;
+
+  srand(seed);
+  for (i = 0; i < sizeof(m_canvas); i++)
+  {
+    m_canvas[i] = rand();
+  }
+}
+
+/**@brief Stream the window: literal runs and repeats, in chunks of any size.
+ */
+static void stream_window(const EPD_Window *window)
+{
+  static unsigned char bytes[sizeof(m_canvas)];
+  unsigned int n = window_bytes(window, bytes), i = 0, len = 0, run, chunk, xb, row;
+  EPD_Stream stream;
+
+  // Every fourth run repeats its first byte
+  memset(bytes, 0x0F, n / 3);
+  while (i < n)
+  {
+    run = 1 + rand() % 40;
+    run = (run > n - i) ? n - i : run;
+    if (rand() % 4 == 0)
+    {
+      m_stream[len++] = 0x80 | (run - 1);
+      m_stream[len++] = bytes[i];
+      memset(&bytes[i], bytes[i], run);
+    }
+    else
+    {
+      m_stream[len++] = run - 1;
+      memcpy(&m_stream[len], &bytes[i], run);
+      len += run;
+    }
+    i += run;
+  }
+
+  // The canvas takes what was streamed, for the check
+  i = 0;
+#if EPD_NATIVE_ORIENTATION
+  for (xb = window->x_start / 8; xb <= window->x_end / 8; xb++)
+    for (row = window->y_start; row <= window->y_end; row++)
+      m_canvas[EPD_FB_INDEX(xb, row)] = bytes[i++];
+#else
+  for (row = window->y_start; row <= window->y_end; row++)
+    for (xb = window->x_start / 8; xb <= window->x_end / 8; xb++)
+      m_canvas[EPD_FB_INDEX(xb, row)] = bytes[i++];
+#endif
+
+  EPD_StreamBegin(&epd, &stream, window);
+  for (i = 0; i < len; i += chunk)
+  {
+    chunk = 1 + rand() % 244;
+    chunk = (chunk > len - i) ? len - i : chunk;
+    if (!EPD_StreamWrite(&epd, &stream, &m_stream[i], chunk))
+    {
+      fail("stream: chunk ran past the window");
+    }
+  }
+  if (!EPD_StreamEnd(&epd, &stream))
+  {
+    fail("stream: window not filled");
+  }
+}
+
+int main(void)
+{
+  static const unsigned char sleep_ssd1680[] = { 0x10, 1, EPD_DEEP_SLEEP_MODE, 0x00, EPD_SEQ_END };
+  static const unsigned char sleep_uc8151[] = { DEEP_SLEEP, 1, 0xA5, 0x00, EPD_SEQ_END };
+  EPD_Window window, box = { 40, 30, 71, 45 };
+  EPD_Window frame = { 0, 0, EPD_WIDTH_BYTES * 8 - 1, EPD_SCREEN_HEIGHT - 1 };
+  EPD_SpiStats stats;
+  unsigned int x, y;
+
+  EpdTransportSelect(&epd_transport_trace);
+  APP_ERROR_CHECK(epd_spi_init());
+  mp_trace = fopen(EPD_TRACE_FILE, "r");
+  if (mp_trace == NULL)
+  {
+    perror(EPD_TRACE_FILE);
+    return 1;
+  }
+  EpdSpiStatsReset();
+
+  if (EPD_Init(&epd) != 0)
+  {
+    fail("EPD_Init failed");
+  }
+  trace_replay();
+  check_sequence("init: panel init sequence missing", epd.panel->init_sequence);
+
+  // Whole frame
+  fill_canvas(1);
+  EPD_LoadFrame(&epd, m_canvas, NULL);
+  trace_replay();
+  check_plane("EPD_LoadFrame", 0);
+  if (EPD_PARTIAL_REFRESH)
+  {
+    check_plane("EPD_LoadFrame old image", 1);
+  }
+
+  // Changed box only
+  for (y = box.y_start; y <= box.y_end; y++)
+    for (x = box.x_start / 8; x <= box.x_end / 8; x++)
+      m_canvas[EPD_FB_INDEX(x, y)] ^= 0x5A;
+  EpdSpiStatsReset();
+  m_trace_bytes = 0;
+  if (!EPD_LoadFrameDiff(&epd, m_canvas, EPD_PARTIAL_REFRESH, &window))
+  {
+    fail("EPD_LoadFrameDiff: change not found");
+  }
+  trace_replay();
+  check_plane("EPD_LoadFrameDiff", 0);
+  if (window.x_start > box.x_start || window.x_end < box.x_end ||
+      window.y_start > box.y_start || window.y_end < box.y_end)
+  {
+    fail("EPD_LoadFrameDiff: window misses the change");
+  }
+  if (m_trace_bytes >= (unsigned long)EPD_HEIGHT * EPD_WIDTH_BYTES)
+  {
+    fail("EPD_LoadFrameDiff: whole plane sent");
+  }
+  EpdSpiStatsGet(&stats);
+  if (stats.bytes != m_trace_bytes)
+  {
+    printf("statistics: %lu bytes counted, %lu in the trace\n",
+           (unsigned long)stats.bytes, m_trace_bytes);
+    fail("statistics differ from the trace");
+  }
+
+  // Streamed windows
+  stream_window(&box);
+  trace_replay();
+  check_plane("EPD_StreamWrite", 0);
+  stream_window(&frame);
+  trace_replay();
+  check_plane("EPD_StreamWrite whole frame", 0);
+
+  EPD_TurnOnDisplay(&epd);
+  EPD_Sleep(&epd);
+  trace_replay();
+  check_sequence("sleep: deep sleep missing", (epd.panel->controller == EPD_CONTROLLER_UC8151)
+                                              ? sleep_uc8151 : sleep_ssd1680);
+  if (m_log_len == 0 || m_log_cmd[m_log_len - 1] != ((epd.panel->controller == EPD_CONTROLLER_UC8151)
+                                                     ? DEEP_SLEEP : 0x10))
+  {
+    fail("sleep: deep sleep is not the last command");
+  }
+
+  printf("epd_trace_test %s: %u failures\n", epd.panel->name, m_fails);
+  return (m_fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,35 @@
+/** @file paint_golden.c
+ *
+ * @brief Prints the hashes of the paint_scene.c screen in every rotation
+ *        and mirroring, for the golden table of paint_test.c.
+ *
+ * @par
+ * make -C test golden builds it with GUI_Paint.c and the fonts of the
+ * baseline commit.
+*/
+
+#include <stdio.h>
+#include "paint_scene.h"
+
+#define SCENE_WIDTH   128
+#define SCENE_HEIGHT  296
+
+static UBYTE m_image[SCENE_WIDTH / 8 * SCENE_HEIGHT];
+
+int main(void)
+{
+    static const UWORD rotations[] = { ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270 };
+    int rotate, mirror;
+
+    for (rotate = 0; rotate < 4; rotate++) {
+        printf("    {");
+        for (mirror = 0; mirror < 4; mirror++) {
+            Paint_NewImage(m_image, SCENE_WIDTH, SCENE_HEIGHT, rotations[rotate], WHITE);
+            Paint_SetMirroring(mirror);
+            Scene_Draw();
+            printf(" 0x%08X,", (unsigned int)Scene_Hash(m_image, sizeof(m_image)));
+        }
+        printf(" },\n");
+    }
+    return 0;
+}
@@ -0,0 +1,284 @@
+/** @file paint_ref.c
+ *
+ * @brief Reference primitives for paint_test.c: GUI_Paint as it drew before
+ *        the byte writers, every pixel through one Ref_SetPixel() that works
+ *        the rotation, mirroring, layout and red box out for itself.
+ *
+ * @par
+ * They draw on whatever Paint holds, the test points Paint.Image and
+ * Paint.ImageRed at the reference buffers before calling them.
+*/
+
+#include <string.h>
+#include "GUI_Paint.h"
+#include "paint_ref.h"
+
+void Ref_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    UWORD X, Y, RX;
+    UDOUBLE Addr, RedAddr;
+    UBYTE Red = 0;
+
+    if(Xpoint >= Paint.Width || Ypoint >= Paint.Height)
+        return;
+
+    if(Paint.Layout == IMAGE_LAYOUT_COLUMNS) {
+        //Screen x runs down the memory columns
+        X = Ypoint;
+        Y = Xpoint;
+    } else {
+        switch(Paint.Rotate) {
+        case ROTATE_0:
+            X = Xpoint;
+            Y = Ypoint;
+            break;
+        case ROTATE_90:
+            X = Paint.WidthMemory - Ypoint - 1;
+            Y = Xpoint;
+            break;
+        case ROTATE_180:
+            X = Paint.WidthMemory - Xpoint - 1;
+            Y = Paint.HeightMemory - Ypoint - 1;
+            break;
+        case ROTATE_270:
+            X = Ypoint;
+            Y = Paint.HeightMemory - Xpoint - 1;
+            break;
+        default:
+            return;
+        }
+        if(Paint.Mirror & MIRROR_HORIZONTAL)
+            X = Paint.WidthMemory - X - 1;
+        if(Paint.Mirror & MIRROR_VERTICAL)
+            Y = Paint.HeightMemory - Y - 1;
+    }
+
+    //Red only shows inside the red box, it is black elsewhere
+    if(Paint.ImageRed != NULL && X / 8 >= Paint.RedXByte && Y >= Paint.RedY &&
+       X / 8 - Paint.RedXByte < Paint.RedWidthByte && Y - Paint.RedY < Paint.RedHeight) {
+        RX = X - Paint.RedXByte * 8;
+        if(Paint.Layout == IMAGE_LAYOUT_COLUMNS)
+            RedAddr = (RX / 8) * Paint.RedHeight + (Y - Paint.RedY);
+        else
+            RedAddr = RX / 8 + (Y - Paint.RedY) * Paint.RedWidthByte;
+        if(Color == RED)
+            Paint.ImageRed[RedAddr] |= 0x80 >> (X % 8);
+        else
+            Paint.ImageRed[RedAddr] &= ~(0x80 >> (X % 8));
+        Red = 1;
+    }
+    if(Color == RED && !Red)
+        Color = BLACK;
+
+    if(Paint.Layout == IMAGE_LAYOUT_COLUMNS)
+        Addr = (X / 8) * Paint.HeightMemory + Y;
+    else
+        Addr = X / 8 + Y * Paint.WidthByte;
+    if(Color == BLACK)
+        Paint.Image[Addr] &= ~(0x80 >> (X % 8));
+    else
+        Paint.Image[Addr] |= 0x80 >> (X % 8);
+}
+
+void Ref_Clear(UWORD Color)
+{
+    UWORD X, Y;
+
+    if(Paint.ImageRed != NULL)
+        memset(Paint.ImageRed, 0x00, Paint.RedWidthByte * Paint.RedHeight);
+    memset(Paint.Image, (Color == RED) ? BLACK : Color, (UDOUBLE)Paint.WidthByte * Paint.HeightByte);
+    if(Color != RED)
+        return;
+    for(Y = 0; Y < Paint.Height; Y++)
+        for(X = 0; X < Paint.Width; X++)
+            Ref_SetPixel(X, Y, RED);
+}
+
+void Ref_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    UWORD X, Y;
+
+    for(Y = Ystart; Y < Yend; Y++)
+        for(X = Xstart; X < Xend; X++)
+            Ref_SetPixel(X, Y, Color);
+}
+
+void Ref_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    int16_t XDir_Num, YDir_Num;
+
+    if(Xpoint > Paint.Width || Ypoint > Paint.Height)
+        return;
+
+    if(Dot_Style == DOT_FILL_AROUND) {
+        for(XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++)
+            for(YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++)
+                Ref_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
+    } else {
+        for(XDir_Num = 0; XDir_Num < Dot_Pixel; XDir_Num++)
+            for(YDir_Num = 0; YDir_Num < Dot_Pixel; YDir_Num++)
+                Ref_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
+    }
+}
+
+void Ref_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                  UWORD Color, LINE_STYLE Line_Style, DOT_PIXEL Dot_Pixel)
+{
+    UWORD Xpoint = Xstart, Ypoint = Ystart;
+    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+    int XAddway = Xstart < Xend ? 1 : -1;
+    int YAddway = Ystart < Yend ? 1 : -1;
+    int Esp = dx + dy;
+    int Dotted_Len = 0;
+
+    if(Xstart > Paint.Width || Ystart > Paint.Height || Xend > Paint.Width || Yend > Paint.Height)
+        return;
+
+    for(;;) {
+        //Every third point of a dotted line is background
+        if(Line_Style == LINE_STYLE_DOTTED && ++Dotted_Len % 3 == 0)
+            Ref_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Dot_Pixel, DOT_STYLE_DFT);
+        else
+            Ref_DrawPoint(Xpoint, Ypoint, Color, Dot_Pixel, DOT_STYLE_DFT);
+        if(2 * Esp >= dy) {
+            if(Xpoint == Xend)
+                break;
+            Esp += dy;
+            Xpoint += XAddway;
+        }
+        if(2 * Esp <= dx) {
+            if(Ypoint == Yend)
+                break;
+            Esp += dx;
+            Ypoint += YAddway;
+        }
+    }
+}
+
+void Ref_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                       UWORD Color, DRAW_FILL Filled, DOT_PIXEL Dot_Pixel)
+{
+    UWORD Ypoint;
+
+    if(Xstart > Paint.Width || Ystart > Paint.Height || Xend > Paint.Width || Yend > Paint.Height)
+        return;
+
+    if(Filled) {
+        for(Ypoint = Ystart; Ypoint < Yend; Ypoint++)
+            Ref_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color, LINE_STYLE_SOLID, Dot_Pixel);
+    } else {
+        Ref_DrawLine(Xstart, Ystart, Xend, Ystart, Color, LINE_STYLE_SOLID, Dot_Pixel);
+        Ref_DrawLine(Xstart, Ystart, Xstart, Yend, Color, LINE_STYLE_SOLID, Dot_Pixel);
+        Ref_DrawLine(Xend, Yend, Xend, Ystart, Color, LINE_STYLE_SOLID, Dot_Pixel);
+        Ref_DrawLine(Xend, Yend, Xstart, Yend, Color, LINE_STYLE_SOLID, Dot_Pixel);
+    }
+}
+
+void Ref_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                    UWORD Color, DRAW_FILL Draw_Fill, DOT_PIXEL Dot_Pixel)
+{
+    int16_t Esp, sCountY;
+    int16_t XCurrent = 0, YCurrent = Radius;
+
+    if(X_Center > Paint.Width || Y_Center >= Paint.Height)
+        return;
+
+    Esp = 3 - (Radius << 1);
+    while(XCurrent <= YCurrent) {
+        if(Draw_Fill == DRAW_FILL_FULL) {
+            for(sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
+                Ref_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                Ref_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+            }
+        } else {
+            Ref_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+            Ref_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+            Ref_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+            Ref_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+            Ref_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+            Ref_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+            Ref_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+            Ref_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Dot_Pixel, DOT_STYLE_DFT);
+        }
+        if(Esp < 0) {
+            Esp += 4 * XCurrent + 6;
+        } else {
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
+
+void Ref_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                  sFONT *Font, UWORD Color_Background, UWORD Color_Foreground)
+{
+    UWORD Page, Column;
+    UWORD RowBytes = (Font->Width + 7) / 8;
+    const unsigned char *ptr;
+
+    if(Xpoint > Paint.Width || Ypoint > Paint.Height)
+        return;
+
+    ptr = &Font->table[(Acsii_Char - ' ') * Font->Height * RowBytes];
+    for(Page = 0; Page < Font->Height; Page++) {
+        for(Column = 0; Column < Font->Width; Column++) {
+            if(ptr[Page * RowBytes + Column / 8] & (0x80 >> (Column % 8)))
+                Ref_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
+            else if(Color_Background != FONT_BACKGROUND)
+                Ref_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
+        }
+    }
+}
+
+void Ref_DrawString_EN(UWORD Xstart, UWORD Ystart, const char *pString,
+                       sFONT *Font, UWORD Color_Background, UWORD Color_Foreground)
+{
+    UWORD Xpoint = Xstart, Ypoint = Ystart;
+
+    if(Xstart > Paint.Width || Ystart > Paint.Height)
+        return;
+
+    //Wraps at the right edge and back to Ystart at the bottom, '^' starts
+    //a new line, read behind the string for the first character
+    for(; *pString != '\0'; pString++, Xpoint += Font->Width) {
+        if(Xpoint + Font->Width > Paint.Width) {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if(Ypoint + Font->Height > Paint.Height) {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        if(pString[-1] == '^') {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if(*pString != '^')
+            Ref_DrawChar(Xpoint, Ypoint, *pString, Font, Color_Background, Color_Foreground);
+    }
+}
+
+void Ref_DrawBitMap(const PAINT_BITMAP *Bitmap, UWORD Xstart, UWORD Ystart)
+{
+    UWORD X, Y, Line, Bit;
+    UWORD LineBytes = (Bitmap->Scan == BITMAP_SCAN_COLUMNS) ? (Bitmap->Height + 7) / 8 : (Bitmap->Width + 7) / 8;
+
+    for(Y = 0; Y < Bitmap->Height; Y++) {
+        for(X = 0; X < Bitmap->Width; X++) {
+            if((UDOUBLE)Xstart + X >= Paint.Width || (UDOUBLE)Ystart + Y >= Paint.Height)
+                continue;
+            Line = (Bitmap->Scan == BITMAP_SCAN_COLUMNS) ? X : Y;
+            Bit = (Bitmap->Scan == BITMAP_SCAN_COLUMNS) ? Y : X;
+            Ref_SetPixel(Xstart + X, Ystart + Y,
+                         (Bitmap->Data[(UDOUBLE)Line * LineBytes + Bit / 8] & (0x80 >> (Bit % 8))) ? WHITE : BLACK);
+        }
+    }
+}
@@ -0,0 +1,27 @@
+/** @file paint_ref.h
+ *
+ * @brief Header file of paint_ref.c, the per-pixel reference primitives
+*/
+
+#ifndef PAINT_REF_H
+#define PAINT_REF_H
+
+#include "GUI_Paint.h"
+
+void Ref_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color);
+void Ref_Clear(UWORD Color);
+void Ref_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+void Ref_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style);
+void Ref_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                  UWORD Color, LINE_STYLE Line_Style, DOT_PIXEL Dot_Pixel);
+void Ref_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend,
+                       UWORD Color, DRAW_FILL Filled, DOT_PIXEL Dot_Pixel);
+void Ref_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius,
+                    UWORD Color, DRAW_FILL Draw_Fill, DOT_PIXEL Dot_Pixel);
+void Ref_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char,
+                  sFONT *Font, UWORD Color_Background, UWORD Color_Foreground);
+void Ref_DrawString_EN(UWORD Xstart, UWORD Ystart, const char *pString,
+                       sFONT *Font, UWORD Color_Background, UWORD Color_Foreground);
+void Ref_DrawBitMap(const PAINT_BITMAP *Bitmap, UWORD Xstart, UWORD Ystart);
+
+#endif /* PAINT_REF_H */
@@ -0,0 +1,56 @@
+/** @file paint_scene.c
+ *
+ * @brief A fixed screen for the golden check of paint_test.c: text as the
+ *        tag draws it, lines, points, rectangles and circles on an image
+ *        of any rotation and mirroring.
+ *
+ * @par
+ * It only uses calls as the baseline GUI_Paint.c had them and stays off
+ * the right and bottom edge, where the baseline Paint_SetPixel() wrote one
+ * pixel past the screen. paint_golden.c draws it with that GUI_Paint.c.
+*/
+
+#include "paint_scene.h"
+
+//Paint_DrawString_EN() reads the byte before the string, a '\0' here
+static const char m_text[] = "\0RESERVED\0WAITING^CHECK-IN\0"
+                             "Room 4.12 ^ 09:00-10:30 Design review, all welcome ~{}|\0";
+#define TEXT_RESERVED  (&m_text[1])
+#define TEXT_WAITING   (&m_text[10])
+#define TEXT_LONG      (&m_text[27])
+
+void Scene_Draw(void)
+{
+    UWORD i;
+
+    Paint_Clear(WHITE);
+    Paint_DrawString_EN(10, 15, TEXT_RESERVED, &Font24, WHITE, BLACK);
+    Paint_DrawString_EN(10, 50, TEXT_WAITING, &Font20, WHITE, BLACK);
+    Paint_DrawString_EN(3, 70, TEXT_LONG, &Font12, BLACK, WHITE);
+    Paint_DrawString_EN(5, 5, TEXT_LONG, &Font8, WHITE, BLACK);
+
+    Paint_DrawLine(2, 2, 100, 90, BLACK, LINE_STYLE_SOLID, DOT_PIXEL_1X1);
+    Paint_DrawLine(110, 4, 6, 60, BLACK, LINE_STYLE_DOTTED, DOT_PIXEL_2X2);
+    Paint_DrawLine(20, 100, 20, 30, WHITE, LINE_STYLE_DOTTED, DOT_PIXEL_1X1);
+    Paint_DrawRectangle(30, 30, 90, 60, BLACK, DRAW_FILL_EMPTY, DOT_PIXEL_2X2);
+    Paint_DrawRectangle(60, 80, 100, 110, BLACK, DRAW_FILL_FULL, DOT_PIXEL_1X1);
+    Paint_DrawCircle(60, 60, 25, BLACK, DRAW_FILL_EMPTY, DOT_PIXEL_1X1);
+    Paint_DrawCircle(90, 30, 12, BLACK, DRAW_FILL_FULL, DOT_PIXEL_1X1);
+    Paint_ClearWindows(70, 85, 90, 95, WHITE);
+
+    for (i = 0; i < 4; i++) {
+        Paint_DrawPoint(10 + 12 * i, 110, BLACK, (DOT_PIXEL)(DOT_PIXEL_1X1 + i), DOT_FILL_AROUND);
+        Paint_DrawPoint(10 + 12 * i, 118, BLACK, (DOT_PIXEL)(DOT_PIXEL_1X1 + i), DOT_FILL_RIGHTUP);
+    }
+    Paint_DrawChar(100, 100, 'A', &Font16, BLACK, WHITE);
+}
+
+//FNV-1a
+uint32_t Scene_Hash(const UBYTE *image, uint32_t size)
+{
+    uint32_t hash = 2166136261u;
+
+    while (size--)
+        hash = (hash ^ *image++) * 16777619u;
+    return hash;
+}
@@ -0,0 +1,16 @@
+/** @file paint_scene.h
+ *
+ * @brief Header file of paint_scene.c, a fixed screen drawn with the calls
+ *        GUI_Paint has had since the baseline
+*/
+
+#ifndef PAINT_SCENE_H
+#define PAINT_SCENE_H
+
+#include <stdint.h>
+#include "GUI_Paint.h"
+
+void Scene_Draw(void);
+uint32_t Scene_Hash(const UBYTE *image, uint32_t size);
+
+#endif /* PAINT_SCENE_H */
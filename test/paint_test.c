@@ -0,0 +1,227 @@
+/** @file paint_test.c
+ *
+ * @brief Draws random calls with GUI_Paint and with the per-pixel reference
+ *        of paint_ref.c, and checks both leave the same image and red box.
+ *
+ * @par
+ * Every rotation and mirroring of the row layout, the column layout, with
+ * and without a red box, the three colors, dot sizes 1 to 4, all fonts and
+ * color pairs, all 160 glyphs with and without font columns, strings that
+ * wrap, solid and dotted lines, both dot styles, bitmaps scanned either way
+ * at any pixel and clipped.
+ *
+ * @par
+ * The screen of paint_scene.c is checked first against the hashes of the
+ * baseline GUI_Paint, in every rotation and mirroring.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "GUI_Paint.h"
+#include "paint_ref.h"
+#include "paint_scene.h"
+
+#define TEST_WIDTH   128
+#define TEST_HEIGHT  296
+#define TEST_CALLS   2000
+#define TEST_MAX_FAILS 20
+
+static UBYTE m_image[TEST_WIDTH / 8 * TEST_HEIGHT], m_ref_image[TEST_WIDTH / 8 * TEST_HEIGHT];
+static UBYTE m_red[600], m_ref_red[600];
+static UBYTE m_bitmap[4000];
+//Paint_DrawString_EN() reads the byte before the string
+static char m_string[1 + 40 + 1];
+static sFONT *const m_fonts[] = { &Font8, &Font12, &Font16, &Font20, &Font24 };
+static const UWORD m_colors[] = { BLACK, WHITE, RED };
+
+static unsigned int m_calls, m_fails;
+
+//Scene_Hash() of the scene by rotation and mirroring, from make golden
+static const uint32_t m_golden[4][4] = {
+    { 0x2067E3AE, 0x18436DE4, 0x0BD7FBF2, 0x07091AF0, },
+    { 0x4C94E0FA, 0x2AD55C04, 0x1528655A, 0xE1F3DAA8, },
+    { 0x07091AF0, 0x0BD7FBF2, 0x18436DE4, 0x2067E3AE, },
+    { 0xE1F3DAA8, 0x1528655A, 0x2AD55C04, 0x4C94E0FA, },
+};
+
+//Point Paint at the reference buffers and back
+static void use_ref(int ref)
+{
+    Paint.Image = ref ? m_ref_image : m_image;
+    if (Paint.ImageRed != NULL)
+        Paint.ImageRed = ref ? m_ref_red : m_red;
+}
+
+static void check(const char *what, int layout, int rotate, int mirror, int red)
+{
+    m_calls++;
+    if (memcmp(m_image, m_ref_image, sizeof(m_image)) == 0 && memcmp(m_red, m_ref_red, sizeof(m_red)) == 0)
+        return;
+
+    if (m_fails++ < TEST_MAX_FAILS)
+        printf("%s differs: layout %d rotate %d mirror %d red %d\n", what, layout, rotate, mirror, red);
+    //Go on from the same image
+    memcpy(m_image, m_ref_image, sizeof(m_image));
+    memcpy(m_red, m_ref_red, sizeof(m_red));
+}
+
+static void check_golden(void)
+{
+    static const UWORD rotations[] = { ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270 };
+    int rotate, mirror;
+    uint32_t hash;
+
+    for (rotate = 0; rotate < 4; rotate++)
+    for (mirror = 0; mirror < 4; mirror++) {
+        Paint_NewImage(m_image, TEST_WIDTH, TEST_HEIGHT, rotations[rotate], WHITE);
+        Paint_SetMirroring(mirror);
+        Scene_Draw();
+        hash = Scene_Hash(m_image, sizeof(m_image));
+        m_calls++;
+        if (hash != m_golden[rotate][mirror] && m_fails++ < TEST_MAX_FAILS)
+            printf("golden scene differs: rotate %d mirror %d hash 0x%08X\n",
+                   rotations[rotate], mirror, (unsigned int)hash);
+    }
+}
+
+//A string of any glyph, with '^' line breaks now and then
+static const char *random_string(void)
+{
+    int i, len = rand() % 40;
+
+    for (i = 1; i <= len; i++)
+        m_string[i] = (rand() % 8 == 0) ? '^' : ' ' + rand() % 160;
+    m_string[i] = '\0';
+    return &m_string[1];
+}
+
+static void draw_random(int layout, int rotate, int mirror, int red)
+{
+    UWORD W = Paint.Width, H = Paint.Height;
+    UWORD X0 = rand() % (W + 1), Y0 = rand() % (H + 1);
+    UWORD X1 = rand() % (W + 1), Y1 = rand() % (H + 1);
+    UWORD Color = m_colors[rand() % 3], Background = m_colors[rand() % 3];
+    DOT_PIXEL Dot = (DOT_PIXEL)(1 + rand() % 4);
+    DRAW_FILL Fill = (DRAW_FILL)(rand() % 2);
+    LINE_STYLE Line = (LINE_STYLE)(rand() % 2);
+    DOT_STYLE Style = (DOT_STYLE)(DOT_FILL_AROUND + rand() % 2);
+    UWORD Radius = rand() % 40;
+    sFONT *Font = m_fonts[rand() % 5];
+    char Char = ' ' + rand() % 160;
+    PAINT_BITMAP Bitmap = { m_bitmap, 1 + rand() % 150, 1 + rand() % 150, rand() % 2 };
+    const char *what = NULL, *String;
+
+    //Mostly small shapes near the edges
+    if (rand() % 4 == 0) {
+        X0 = rand() % 4;
+        Y0 = rand() % 4;
+    }
+    if (rand() % 2) {
+        X1 = (X0 + rand() % 30 > W) ? W : X0 + rand() % 30;
+        Y1 = (Y0 + rand() % 30 > H) ? H : Y0 + rand() % 30;
+    }
+
+    switch (rand() % 10) {
+    case 0:
+        what = "Paint_DrawRectangle";
+        Paint_DrawRectangle(X0, Y0, X1, Y1, Color, Fill, Dot);
+        use_ref(1);
+        Ref_DrawRectangle(X0, Y0, X1, Y1, Color, Fill, Dot);
+        break;
+    case 1:
+        what = "Paint_DrawCircle";
+        Paint_DrawCircle(X0, Y0, Radius, Color, Fill, Dot);
+        use_ref(1);
+        Ref_DrawCircle(X0, Y0, Radius, Color, Fill, Dot);
+        break;
+    case 2:
+        what = "Paint_ClearWindows";
+        Paint_ClearWindows(X0, Y0, X1, Y1, Color);
+        use_ref(1);
+        Ref_ClearWindows(X0, Y0, X1, Y1, Color);
+        break;
+    case 3:
+        if (rand() % 20)
+            return;
+        what = "Paint_Clear";
+        Paint_Clear(Color);
+        use_ref(1);
+        Ref_Clear(Color);
+        break;
+    case 4:
+    case 5:
+        what = "Paint_DrawChar";
+        Paint_DrawChar(X0, Y0, Char, Font, Background, Color);
+        use_ref(1);
+        Ref_DrawChar(X0, Y0, Char, Font, Background, Color);
+        break;
+    case 6:
+        what = "Paint_DrawBitMap";
+        Paint_DrawBitMap(&Bitmap, X0, Y0);
+        use_ref(1);
+        Ref_DrawBitMap(&Bitmap, X0, Y0);
+        break;
+    case 7:
+        what = "Paint_DrawLine";
+        Paint_DrawLine(X0, Y0, X1, Y1, Color, Line, Dot);
+        use_ref(1);
+        Ref_DrawLine(X0, Y0, X1, Y1, Color, Line, Dot);
+        break;
+    case 8:
+        what = "Paint_DrawPoint";
+        Paint_DrawPoint(X0, Y0, Color, Dot, Style);
+        use_ref(1);
+        Ref_DrawPoint(X0, Y0, Color, Dot, Style);
+        break;
+    case 9:
+        what = "Paint_DrawString_EN";
+        String = random_string();
+        Paint_DrawString_EN(X0, Y0, String, Font, Background, Color);
+        use_ref(1);
+        Ref_DrawString_EN(X0, Y0, String, Font, Background, Color);
+        break;
+    }
+    use_ref(0);
+    check(what, layout, rotate, mirror, red);
+}
+
+int main(void)
+{
+    static const UWORD rotations[] = { ROTATE_0, ROTATE_90, ROTATE_180, ROTATE_270 };
+    int layout, rotate, mirror, red;
+    unsigned int i;
+
+    check_golden();
+
+    srand(1);
+    for (i = 0; i < sizeof(m_bitmap); i++)
+        m_bitmap[i] = rand();
+
+    for (layout = 0; layout < 2; layout++)
+    for (rotate = 0; rotate < 4; rotate++)
+    for (mirror = 0; mirror < 4; mirror++)
+    for (red = 0; red < 2; red++) {
+        //The column layout has no rotation or mirroring of its own
+        if (layout == IMAGE_LAYOUT_COLUMNS && (rotate != 0 || mirror != 0))
+            continue;
+
+        for (i = 0; i < sizeof(m_image); i++)
+            m_image[i] = m_ref_image[i] = (i * 37) ^ (i >> 3);
+        Paint_NewImage(m_image, TEST_WIDTH, TEST_HEIGHT, rotations[rotate], WHITE);
+        if (layout == IMAGE_LAYOUT_COLUMNS)
+            Paint_SetLayout(IMAGE_LAYOUT_COLUMNS);
+        else
+            Paint_SetMirroring(mirror);
+        if (red) {
+            Paint_SelectRedImage(m_ref_red, sizeof(m_ref_red), 10, 10, 60, 40);
+            Paint_SelectRedImage(m_red, sizeof(m_red), 10, 10, 60, 40);
+        }
+
+        for (i = 0; i < TEST_CALLS; i++)
+            draw_random(layout, rotations[rotate], mirror, red);
+    }
+
+    printf("paint_test: %u calls, %u differ\n", m_calls, m_fails);
+    return (m_fails == 0) ? 0 : 1;
+}
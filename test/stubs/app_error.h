@@ -0,0 +1,43 @@
+/* Host build: the SDK error codes and checks the EPD driver uses. A failed
+   check ends the test. */
+#ifndef APP_ERROR_H__
+#define APP_ERROR_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "sdk_errors.h"
+
+#define NRF_SUCCESS               0
+#define NRF_ERROR_INTERNAL        3
+#define NRF_ERROR_NOT_SUPPORTED   6
+#define NRF_ERROR_INVALID_STATE   8
+#define NRF_ERROR_INVALID_LENGTH  9
+#define NRF_ERROR_INVALID_DATA    11
+#define NRF_ERROR_TIMEOUT         13
+#define NRF_ERROR_BUSY            17
+
+#define APP_ERROR_CHECK(err_code)                                              \
+  do                                                                           \
+  {                                                                            \
+    ret_code_t err_ = (err_code);                                              \
+    if (err_ != NRF_SUCCESS)                                                   \
+    {                                                                          \
+      fprintf(stderr, "%s:%d: error %u\n", __FILE__, __LINE__, (unsigned)err_); \
+      exit(1);                                                                 \
+    }                                                                          \
+  } while (0)
+
+#define UNUSED_PARAMETER(x) ((void)(x))
+#define UNUSED_VARIABLE(x)  ((void)(x))
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+#endif
@@ -0,0 +1,4 @@
+/* Host build: no device, GUI_Paint.c takes its portable paths */
+#ifndef NRF_H
+#define NRF_H
+#endif
@@ -0,0 +1,9 @@
+/* Host build: delays go to epd_stubs.c */
+#ifndef NRF_DELAY_H__
+#define NRF_DELAY_H__
+
+#include <stdint.h>
+
+void nrf_delay_ms(uint32_t ms_time);
+
+#endif
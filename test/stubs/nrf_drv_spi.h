@@ -0,0 +1,52 @@
+/* Host build: the SPI driver of the blocking backend, calls go to epd_stubs.c */
+#ifndef NRF_DRV_SPI_H__
+#define NRF_DRV_SPI_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "app_error.h"
+
+#define SPI_BUSY_PIN 4 // sdk_config.h
+
+typedef struct
+{
+  uint8_t inst_idx;
+} nrf_drv_spi_t;
+
+#define NRF_DRV_SPI_INSTANCE(id) { id }
+
+typedef struct
+{
+  uint8_t sck_pin;
+  uint8_t mosi_pin;
+  uint8_t miso_pin;
+  uint8_t ss_pin;
+  uint8_t irq_priority;
+  uint32_t frequency;
+} nrf_drv_spi_config_t;
+
+#define NRF_DRV_SPI_DEFAULT_CONFIG { 0 }
+#define NRF_DRV_SPI_PIN_NOT_USED   0xFF
+#define NRF_DRV_SPI_FREQ_1M        0x10000000UL
+
+typedef struct
+{
+  int type;
+} nrf_drv_spi_evt_t;
+
+typedef void (*nrf_drv_spi_evt_handler_t)(nrf_drv_spi_evt_t const *p_event, void *p_context);
+
+ret_code_t nrf_drv_spi_init(nrf_drv_spi_t const *p_instance, nrf_drv_spi_config_t const *p_config,
+                            nrf_drv_spi_evt_handler_t handler, void *p_context);
+void nrf_drv_spi_uninit(nrf_drv_spi_t const *p_instance);
+ret_code_t nrf_drv_spi_transfer(nrf_drv_spi_t const *p_instance, uint8_t const *p_tx_buffer,
+                                uint8_t tx_buffer_length, uint8_t *p_rx_buffer,
+                                uint8_t rx_buffer_length);
+
+static inline bool nrfx_is_in_ram(void const *p_object)
+{
+  (void)p_object;
+  return true;
+}
+
+#endif
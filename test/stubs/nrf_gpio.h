@@ -0,0 +1,15 @@
+/* Host build: GPIO calls go to epd_stubs.c */
+#ifndef NRF_GPIO_H__
+#define NRF_GPIO_H__
+
+#include <stdint.h>
+
+#define NRF_GPIO_PIN_DIR_OUTPUT 1
+#define NRF_GPIO_PIN_PULLUP     3
+
+void nrf_gpio_pin_dir_set(uint32_t pin_number, int direction);
+void nrf_gpio_cfg_input(uint32_t pin_number, int pull_config);
+void nrf_gpio_pin_write(uint32_t pin_number, uint32_t value);
+uint32_t nrf_gpio_pin_read(uint32_t pin_number);
+
+#endif
@@ -0,0 +1 @@
+/* Host build: nothing of the LCD API is used */
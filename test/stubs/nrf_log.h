@@ -0,0 +1,10 @@
+/* Host build: no log */
+#ifndef NRF_LOG_H__
+#define NRF_LOG_H__
+
+#define NRF_LOG_ERROR(...)   do { } while (0)
+#define NRF_LOG_WARNING(...) do { } while (0)
+#define NRF_LOG_INFO(...)    do { } while (0)
+#define NRF_LOG_DEBUG(...)   do { } while (0)
+
+#endif
@@ -0,0 +1,9 @@
+/* Host build: SoftDevice calls go to epd_stubs.c */
+#ifndef NRF_SOC_H__
+#define NRF_SOC_H__
+
+#include <stdint.h>
+
+uint32_t sd_temp_get(int32_t *p_temp);
+
+#endif
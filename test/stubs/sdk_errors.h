@@ -0,0 +1,9 @@
+/* Host build: the SDK names epd.h needs */
+#ifndef SDK_ERRORS_H__
+#define SDK_ERRORS_H__
+
+#include <stdint.h>
+
+typedef uint32_t ret_code_t;
+
+#endif